@@ -0,0 +1,120 @@
+#include "AffineBlit.h"
+
+#include <math.h>
+#include <algorithm>
+
+namespace
+{
+  int64_t floorDiv(const int64_t a, const int64_t b)
+  {
+    const int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0) ? q - 1 : q);
+  }
+
+  // narrows [x0,x1) to the x where 0 <= start + step*x < limit
+  void clipSpan(const int64_t start, const int64_t step, const int64_t limit, int32_t& x0, int32_t& x1)
+  {
+    if (step == 0)
+    {
+      if (start < 0 || start >= limit)
+        x1 = x0;
+      return;
+    }
+
+    // step*x within [low, high], then divide through by |step|
+    int64_t low = -start, high = limit - 1 - start, s = step;
+    if (s < 0)
+    {
+      std::swap(low, high);
+      low = -low;
+      high = -high;
+      s = -s;
+    }
+
+    x0 = std::max<int64_t>(x0, -floorDiv(-low, s));
+    x1 = std::min<int64_t>(x1, floorDiv(high, s) + 1);
+  }
+}
+
+AffineBlit::AffineBlit() : _degrees(0), _width(0), _height(0), _pivotX(0), _pivotY(0), _screenX(0), _screenY(0), _cos(1L << 16), _sin(0)
+{
+}
+
+void AffineBlit::setRotation(const float degrees, const int16_t width, const int16_t height, const float pivotX, const float pivotY,
+                             const float screenX, const float screenY)
+{
+  const float radians = degrees * (float)M_PI / 180.0f;
+  _degrees = degrees;
+  _width = width;
+  _height = height;
+  _pivotX = lroundf(pivotX * 65536.0f);
+  _pivotY = lroundf(pivotY * 65536.0f);
+  _screenX = lroundf(screenX * 65536.0f);
+  _screenY = lroundf(screenY * 65536.0f);
+  _cos = lroundf(cosf(radians) * 65536.0f);
+  _sin = lroundf(sinf(radians) * 65536.0f);
+}
+
+uint32_t AffineBlit::blit(uint16_t* dest, const uint16_t* source, const uint16_t backColour) const
+{
+  if (dest == nullptr || source == nullptr || _width <= 0 || _height <= 0)
+    return 0;
+
+  // the inverse matrix takes a screen pixel centre back to the source: one column of it per pixel across
+  const int64_t du = _cos;
+  const int64_t dv = -_sin;
+  const int64_t x = (1L << 15) - _screenX;
+
+  uint32_t drawn = 0;
+  for (int sy = 0; sy < _height; sy++)
+  {
+    const int64_t y = ((int64_t)sy << 16) + (1L << 15) - _screenY;
+    const int32_t u0 = ((du * x - dv * y) >> 16) + _pivotX;
+    const int32_t v0 = ((dv * x + du * y) >> 16) + _pivotY;
+
+    int32_t x0 = 0, x1 = _width;
+    clipSpan(u0, du, (int64_t)_width << 16, x0, x1);
+    clipSpan(v0, dv, (int64_t)_height << 16, x0, x1);
+
+    uint16_t* row = dest + (size_t)sy * _width;
+    if (x1 <= x0)
+    {
+      std::fill(row, row + _width, backColour);
+      continue;
+    }
+
+    std::fill(row, row + x0, backColour);
+    std::fill(row + x1, row + _width, backColour);
+
+    int32_t u = u0 + (int32_t)du * x0;
+    int32_t v = v0 + (int32_t)dv * x0;
+    for (int32_t sx = x0; sx < x1; sx++)
+    {
+      row[sx] = source[(v >> 16) * _width + (u >> 16)];
+      u += du;
+      v += dv;
+    }
+    drawn += x1 - x0;
+  }
+
+  return drawn;
+}
+
+void AffineBlit::toScreen(const float x, const float y, float& screenX, float& screenY) const
+{
+  const float px = _pivotX / 65536.0f;
+  const float py = _pivotY / 65536.0f;
+  const float c = _cos / 65536.0f;
+  const float s = _sin / 65536.0f;
+  screenX = c * (x - px) - s * (y - py) + _screenX / 65536.0f;
+  screenY = s * (x - px) + c * (y - py) + _screenY / 65536.0f;
+}
+
+void AffineBlit::toScreen(const int16_t x, const int16_t y, int16_t& screenX, int16_t& screenY) const
+{
+  // pixel centre to pixel centre
+  float sx, sy;
+  toScreen(x + 0.5f, y + 0.5f, sx, sy);
+  screenX = floorf(sx);
+  screenY = floorf(sy);
+}
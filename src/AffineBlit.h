@@ -0,0 +1,52 @@
+#ifndef AffineBlit_h
+#define AffineBlit_h
+
+#include <stdint.h>
+
+/* Rotates a screen-sized image about a pivot into another, for the heading-up
+ * map, optionally moving the pivot to another point on screen.
+ *
+ * The matrix is 16.16 fixed point and the sine and cosine are taken once, in
+ * setRotation(). blit() walks each screen row as a DDA, stepping the source
+ * position by one column of the inverse matrix per pixel, with no trig and no
+ * bounds test per pixel: the run of each row that lands on the source is
+ * clipped up front and the rest filled with the back colour. Overlays drawn
+ * over the rotated image go through toScreen(), the same matrix forwards.
+ */
+class AffineBlit
+{
+  public:
+    AffineBlit();
+
+    // turns the image degrees clockwise about pivotX,pivotY, which stays where it is on screen
+    void setRotation(const float degrees, const int16_t width, const int16_t height, const float pivotX, const float pivotY)
+    {
+      setRotation(degrees, width, height, pivotX, pivotY, pivotX, pivotY);
+    }
+
+    // as above, with the pivot moved to screenX,screenY
+    void setRotation(const float degrees, const int16_t width, const int16_t height, const float pivotX, const float pivotY,
+                     const float screenX, const float screenY);
+
+    float rotationDegrees() const   { return _degrees; }
+
+    // nearest-neighbour rotate of source into dest, both width x height; returns the pixels taken from source
+    uint32_t blit(uint16_t* dest, const uint16_t* source, const uint16_t backColour) const;
+
+    // where a source pixel lands on screen
+    void toScreen(const float x, const float y, float& screenX, float& screenY) const;
+    void toScreen(const int16_t x, const int16_t y, int16_t& screenX, int16_t& screenY) const;
+
+  private:
+    float _degrees;
+    int16_t _width;
+    int16_t _height;
+    int32_t _pivotX;        // 16.16
+    int32_t _pivotY;
+    int32_t _screenX;       // 16.16, where the pivot lands
+    int32_t _screenY;
+    int32_t _cos;           // 16.16
+    int32_t _sin;
+};
+
+#endif
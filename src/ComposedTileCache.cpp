@@ -0,0 +1,108 @@
+#include "ComposedTileCache.h"
+
+#include <string.h>
+
+#include "PsramAlloc.h"
+
+ComposedTileCache::ComposedTileCache() : _maxSlots(0), _slotsAllocated(0), _tileBytes(0), _useCounter(0), _hits(0), _misses(0)
+{
+  for (int i=0; i < s_maxSlots; i++)
+  {
+    _slots[i].valid = false;
+    _slots[i].pixels = nullptr;
+  }
+}
+
+ComposedTileCache::~ComposedTileCache()
+{
+  release();
+}
+
+void ComposedTileCache::configure(const size_t budgetBytes, const size_t tileBytes)
+{
+  release();
+
+  _tileBytes = tileBytes;
+  _maxSlots = (tileBytes > 0 ? budgetBytes / tileBytes : 0);
+  if (_maxSlots > s_maxSlots)
+    _maxSlots = s_maxSlots;
+}
+
+void ComposedTileCache::release()
+{
+  for (int i=0; i < _slotsAllocated; i++)
+  {
+    psramFree(_slots[i].pixels);
+    _slots[i].pixels = nullptr;
+    _slots[i].valid = false;
+  }
+  _slotsAllocated = 0;
+}
+
+void ComposedTileCache::clear()
+{
+  for (int i=0; i < _slotsAllocated; i++)
+    _slots[i].valid = false;
+}
+
+int ComposedTileCache::findSlot(const Key& key) const
+{
+  for (int i=0; i < _slotsAllocated; i++)
+  {
+    if (_slots[i].valid && _slots[i].key == key)
+      return i;
+  }
+  return -1;
+}
+
+bool ComposedTileCache::fetch(const Key& key, void* dest)
+{
+  const int i = findSlot(key);
+  if (i < 0 || dest == nullptr)
+  {
+    _misses++;
+    return false;
+  }
+
+  memcpy(dest, _slots[i].pixels, _tileBytes);
+  _slots[i].lastUsed = ++_useCounter;
+  _hits++;
+  return true;
+}
+
+void ComposedTileCache::store(const Key& key, const void* src)
+{
+  if (_maxSlots == 0 || src == nullptr)
+    return;
+
+  int i = findSlot(key);
+
+  // a free slot while the budget allows, otherwise the least recently used
+  if (i < 0 && _slotsAllocated < _maxSlots)
+  {
+    uint8_t* pixels = (uint8_t*)psramMalloc(_tileBytes);
+    if (pixels)
+    {
+      i = _slotsAllocated++;
+      _slots[i].pixels = pixels;
+    }
+  }
+
+  if (i < 0)
+  {
+    if (_slotsAllocated == 0)
+      return;
+
+    i = 0;
+    for (int s=1; s < _slotsAllocated; s++)
+    {
+      if (!_slots[s].valid || (_slots[i].valid && _slots[s].lastUsed < _slots[i].lastUsed))
+        i = s;
+    }
+  }
+
+  memcpy(_slots[i].pixels, src, _tileBytes);
+  _slots[i].key = key;
+  _slots[i].valid = true;
+  _slots[i].lastUsed = ++_useCounter;
+}
@@ -0,0 +1,75 @@
+#ifndef ComposedTileCache_h
+#define ComposedTileCache_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* LRU cache of fully composed base-map tiles - map image, features and scale
+ * bar - so revisiting a tile after a zoom cycle or tile change is one memcpy
+ * instead of a rescale and redraw.
+ *
+ * Slots are whole screen buffers, allocated on first use (PSRAM when
+ * available) up to as many as fit in the byte budget; when all are in use the
+ * least recently used is overwritten. Static overlays are drawn over the tile
+ * after it is fetched, so editing them never evicts anything.
+ */
+class ComposedTileCache
+{
+  public:
+    static const int s_maxSlots = 32;
+
+    class Key
+    {
+      public:
+        const void* map;
+        uint32_t zoom;          // 16.16, as ZoomScale
+        int16_t tileX;
+        int16_t tileY;
+        bool drawAllFeatures;
+
+        bool operator==(const Key& k) const
+        {
+          return map == k.map && zoom == k.zoom && tileX == k.tileX && tileY == k.tileY && drawAllFeatures == k.drawAllFeatures;
+        }
+    };
+
+    ComposedTileCache();
+    ~ComposedTileCache();
+
+    void configure(const size_t budgetBytes, const size_t tileBytes);
+    void release();
+    void clear();           // forget every tile but keep the buffers
+
+    // copies the tile into dest and marks it most recently used; false on a miss
+    bool fetch(const Key& key, void* dest);
+    void store(const Key& key, const void* src);
+    bool contains(const Key& key) const   { return findSlot(key) >= 0; }
+
+    bool isEnabled() const          { return _maxSlots > 0; }
+    int slotsAllocated() const      { return _slotsAllocated; }
+    size_t bytesAllocated() const   { return _slotsAllocated * _tileBytes; }
+    uint32_t hits() const           { return _hits; }
+    uint32_t misses() const         { return _misses; }
+
+  private:
+    class Slot
+    {
+      public:
+        Key key;
+        bool valid;
+        uint32_t lastUsed;
+        uint8_t* pixels;
+    };
+
+    int findSlot(const Key& key) const;
+
+    Slot _slots[s_maxSlots];
+    int _maxSlots;
+    int _slotsAllocated;
+    size_t _tileBytes;
+    uint32_t _useCounter;
+    uint32_t _hits;
+    uint32_t _misses;
+};
+
+#endif
@@ -0,0 +1,218 @@
+#include "CrumbExporter.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+static const uint8_t s_binaryHeader[] = { 'B', 'C', 'L', 1 };
+static const uint8_t s_binaryFooter[] = { 0 };
+
+static const char s_gpxHeader[] =
+  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+  "<gpx version=\"1.1\" creator=\"MapScreen_ex\" xmlns=\"http://www.topografix.com/GPX/1/1\">\n"
+  "<trk><name>breadcrumbs</name><trkseg>\n";
+static const char s_gpxFooter[] = "</trkseg></trk>\n</gpx>\n";
+
+CrumbExporter::CrumbExporter() : _log(nullptr), _format(e_binary), _stage(e_done), _segment(0), _segmentPosition(0),
+                                 _segmentCrumbsSent(0), _segmentBytesSent(0),
+                                 _textLength(0), _textPosition(0), _hasTimeBase(false), _epochSeconds(0), _epochAtMillis(0),
+                                 _crumbsExported(0), _bytesExported(0)
+{
+  memset(_segmentHeader, 0, sizeof(_segmentHeader));
+}
+
+void CrumbExporter::begin(const CrumbLog& log, const Format format)
+{
+  _log = &log;
+  _format = format;
+  _stage = e_header;
+  _segment = 0;
+  _segmentPosition = 0;
+  _segmentCrumbsSent = 0;
+  _segmentBytesSent = 0;
+  _iterator = log.begin();
+  _crumbsExported = 0;
+  _bytesExported = 0;
+
+  _textLength = 0;
+  _textPosition = 0;
+}
+
+void CrumbExporter::cancel()
+{
+  _log = nullptr;
+  _stage = e_done;
+}
+
+void CrumbExporter::setTimeBase(const uint32_t epochSeconds, const uint32_t atMillis)
+{
+  _hasTimeBase = true;
+  _epochSeconds = epochSeconds;
+  _epochAtMillis = atMillis;
+}
+
+size_t CrumbExporter::read(uint8_t* chunk, const size_t capacity)
+{
+  if (_log == nullptr || chunk == nullptr || capacity == 0)
+    return 0;
+
+  const size_t n = (_format == e_binary ? readBinary(chunk, capacity) : readGpx(chunk, capacity));
+  _bytesExported += n;
+
+  if (_stage == e_done)
+    _log = nullptr;
+
+  return n;
+}
+
+// copy out what remains of a literal, returning true once it is all out
+static bool copyLiteral(const uint8_t* literal, const size_t length, int& position, uint8_t* chunk, const size_t capacity, size_t& used)
+{
+  const size_t n = std::min(length - position, capacity - used);
+  memcpy(chunk + used, literal + position, n);
+  position += n;
+  used += n;
+  return (size_t)position == length;
+}
+
+size_t CrumbExporter::readBinary(uint8_t* chunk, const size_t capacity)
+{
+  size_t used = 0;
+
+  while (used < capacity && _stage != e_done)
+  {
+    if (_stage == e_header)
+    {
+      if (copyLiteral(s_binaryHeader, sizeof(s_binaryHeader), _textPosition, chunk, capacity, used))
+        _stage = e_body;
+      continue;
+    }
+
+    if (_stage == e_footer)
+    {
+      if (copyLiteral(s_binaryFooter, sizeof(s_binaryFooter), _textPosition, chunk, capacity, used))
+        _stage = e_done;
+      continue;
+    }
+
+    const uint8_t* data;
+    uint32_t bytes;
+    int crumbs;
+    if (!_log->segmentData(_segment, data, bytes, crumbs))
+    {
+      _stage = e_footer;
+      _textPosition = 0;
+      continue;
+    }
+
+    if (_segmentPosition == 0)
+    {
+      // the open segment may have grown since its last frame went out: send the rest as a continuation
+      if (crumbs == _segmentCrumbsSent)
+      {
+        _segment++;
+        _segmentCrumbsSent = 0;
+        _segmentBytesSent = 0;
+        continue;
+      }
+
+      const uint32_t frameRecordBytes = bytes - _segmentBytesSent;
+      _segmentHeader[0] = (uint8_t)(crumbs - _segmentCrumbsSent);
+      _segmentHeader[1] = (uint8_t)(frameRecordBytes & 0xFF);
+      _segmentHeader[2] = (uint8_t)(frameRecordBytes >> 8);
+    }
+
+    // the header fixes how much goes out in this frame, however much the open segment grows meanwhile
+    const uint32_t frameBytes = sizeof(_segmentHeader) + (_segmentHeader[1] | (_segmentHeader[2] << 8));
+
+    if (_segmentPosition < sizeof(_segmentHeader))
+    {
+      const size_t n = std::min((size_t)(sizeof(_segmentHeader) - _segmentPosition), capacity - used);
+      memcpy(chunk + used, _segmentHeader + _segmentPosition, n);
+      _segmentPosition += n;
+      used += n;
+    }
+
+    if (_segmentPosition >= sizeof(_segmentHeader) && used < capacity)
+    {
+      const size_t n = std::min((size_t)(frameBytes - _segmentPosition), capacity - used);
+      memcpy(chunk + used, data + _segmentBytesSent + (_segmentPosition - sizeof(_segmentHeader)), n);
+      _segmentPosition += n;
+      used += n;
+    }
+
+    if (_segmentPosition == frameBytes)
+    {
+      _crumbsExported += _segmentHeader[0];
+      _segmentCrumbsSent += _segmentHeader[0];
+      _segmentBytesSent += frameBytes - sizeof(_segmentHeader);
+      _segmentPosition = 0;
+    }
+  }
+
+  return used;
+}
+
+int CrumbExporter::formatGpxPoint(const CrumbLog::Crumb& crumb)
+{
+  int n = snprintf(_text, sizeof(_text), "<trkpt lat=\"%.6f\" lon=\"%.6f\"><ele>%.1f</ele>",
+                   crumb.lat(), crumb.lng(), -crumb.depthMetres());
+
+  if (_hasTimeBase)
+  {
+    const time_t t = (time_t)(_epochSeconds + (int32_t)(crumb.timeMs - _epochAtMillis) / 1000);
+    struct tm utc;
+    gmtime_r(&t, &utc);
+    n += strftime(_text + n, sizeof(_text) - n, "<time>%Y-%m-%dT%H:%M:%SZ</time>", &utc);
+  }
+
+  n += snprintf(_text + n, sizeof(_text) - n, "<extensions><heading>%.1f</heading><ms>%lu</ms></extensions></trkpt>\n",
+                crumb.headingDegrees(), (unsigned long)crumb.timeMs);
+
+  return std::min(n, (int)sizeof(_text) - 1);
+}
+
+size_t CrumbExporter::readGpx(uint8_t* chunk, const size_t capacity)
+{
+  size_t used = 0;
+
+  while (used < capacity && _stage != e_done)
+  {
+    if (_stage == e_header)
+    {
+      if (copyLiteral((const uint8_t*)s_gpxHeader, sizeof(s_gpxHeader) - 1, _textPosition, chunk, capacity, used))
+      {
+        _stage = e_body;
+        _textPosition = _textLength = 0;
+      }
+      continue;
+    }
+
+    if (_stage == e_footer)
+    {
+      if (copyLiteral((const uint8_t*)s_gpxFooter, sizeof(s_gpxFooter) - 1, _textPosition, chunk, capacity, used))
+        _stage = e_done;
+      continue;
+    }
+
+    if (_textPosition == _textLength)
+    {
+      CrumbLog::Crumb crumb;
+      if (!_iterator.next(crumb))
+      {
+        _stage = e_footer;
+        _textPosition = 0;
+        continue;
+      }
+
+      _textLength = formatGpxPoint(crumb);
+      _textPosition = 0;
+      _crumbsExported++;
+    }
+
+    copyLiteral((const uint8_t*)_text, _textLength, _textPosition, chunk, capacity, used);
+  }
+
+  return used;
+}
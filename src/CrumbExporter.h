@@ -0,0 +1,76 @@
+#ifndef CrumbExporter_h
+#define CrumbExporter_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "CrumbLog.h"
+
+/* Streams a CrumbLog out in caller-sized chunks, reading straight from the log.
+ *
+ * Binary is the log's own encoding, copied segment by segment with no decode:
+ *   "BCL" version(1)
+ *   per segment: crumbCount(u8) byteCount(u16 LE) then the encoded records,
+ *                which start with a keyframe and decode as in CrumbLog
+ *   crumbCount 0 ends the stream
+ * A frame whose first record is not a keyframe continues the segment before it,
+ * so the decoder carries its delta state over: crumbs appended to the open
+ * segment after its frame went out follow as a continuation frame.
+ * GPX is one <trkpt> per crumb for host tools, formatted a crumb at a time.
+ *
+ * Nothing is allocated: read() fills the chunk it is given and returns the byte
+ * count, 0 once done. The log must not be thinned or cleared while exporting;
+ * crumbs appended during the export are included until the footer goes out.
+ */
+class CrumbExporter
+{
+  public:
+    enum Format { e_binary, e_gpx };
+
+    CrumbExporter();
+
+    void begin(const CrumbLog& log, const Format format);
+    void cancel();
+
+    // GPX <time> needs wall-clock time: give the UTC epoch seconds at a millis() value, or omit the element
+    void setTimeBase(const uint32_t epochSeconds, const uint32_t atMillis);
+
+    size_t read(uint8_t* chunk, const size_t capacity);
+
+    bool isActive() const               { return _log != nullptr; }
+    uint32_t crumbsExported() const     { return _crumbsExported; }
+    uint32_t bytesExported() const      { return _bytesExported; }
+
+  private:
+    enum Stage { e_header, e_body, e_footer, e_done };
+
+    size_t readBinary(uint8_t* chunk, const size_t capacity);
+    size_t readGpx(uint8_t* chunk, const size_t capacity);
+    int formatGpxPoint(const CrumbLog::Crumb& crumb);
+
+    const CrumbLog* _log;
+    Format _format;
+    Stage _stage;
+
+    // binary: position within the current frame, header bytes first, and how much of the segment earlier frames sent
+    int _segment;
+    uint32_t _segmentPosition;
+    uint8_t _segmentHeader[3];
+    int _segmentCrumbsSent;
+    uint32_t _segmentBytesSent;
+
+    // gpx: the formatted text not yet copied out, which may span chunks
+    CrumbLog::Iterator _iterator;
+    char _text[224];
+    int _textLength;
+    int _textPosition;
+
+    bool _hasTimeBase;
+    uint32_t _epochSeconds;
+    uint32_t _epochAtMillis;
+
+    uint32_t _crumbsExported;
+    uint32_t _bytesExported;
+};
+
+#endif
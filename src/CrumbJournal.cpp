@@ -0,0 +1,290 @@
+#include "CrumbJournal.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include <LittleFS.h>
+#include <FS.h>
+
+static const uint8_t s_recordMarker = 0xCB;
+
+// CRC-16/CCITT-FALSE, bitwise - 16 bytes a record is not worth a table
+static uint16_t crc16(const uint8_t* p, const int n)
+{
+  uint16_t crc = 0xFFFF;
+  for (int i=0; i < n; i++)
+  {
+    crc ^= (uint16_t)p[i] << 8;
+    for (int b=0; b < 8; b++)
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+  }
+  return crc;
+}
+
+CrumbJournal::CrumbJournal() : _pending(0), _oldestPendingMs(0), _journalBytes(0), _recordsWritten(0), _recordsDropped(0)
+{
+  _filename[0] = '\0';
+  _rotatedFilename[0] = '\0';
+}
+
+void CrumbJournal::begin(const char* filename, const char* rotatedFilename)
+{
+  strncpy(_filename, filename, sizeof(_filename) - 1);
+  _filename[sizeof(_filename) - 1] = '\0';
+  strncpy(_rotatedFilename, rotatedFilename, sizeof(_rotatedFilename) - 1);
+  _rotatedFilename[sizeof(_rotatedFilename) - 1] = '\0';
+
+  _pending = 0;
+  _journalBytes = 0;
+}
+
+void CrumbJournal::encode(const CrumbLog::Crumb& crumb, uint8_t* record)
+{
+  record[0] = s_recordMarker;
+  record[1] = crumb.heading;
+  memcpy(record + 2, &crumb.depthDm, 2);
+  memcpy(record + 4, &crumb.latE6, 4);
+  memcpy(record + 8, &crumb.lngE6, 4);
+  memcpy(record + 12, &crumb.timeMs, 4);
+
+  const uint16_t crc = crc16(record, s_recordBytes - 2);
+  memcpy(record + 16, &crc, 2);
+}
+
+bool CrumbJournal::decode(const uint8_t* record, CrumbLog::Crumb& crumb)
+{
+  uint16_t crc;
+  memcpy(&crc, record + 16, 2);
+  if (record[0] != s_recordMarker || crc != crc16(record, s_recordBytes - 2))
+    return false;
+
+  crumb.heading = record[1];
+  memcpy(&crumb.depthDm, record + 2, 2);
+  memcpy(&crumb.latE6, record + 4, 4);
+  memcpy(&crumb.lngE6, record + 8, 4);
+  memcpy(&crumb.timeMs, record + 12, 4);
+  return true;
+}
+
+int CrumbJournal::recover(const std::function<void(const CrumbLog::Crumb&)>& replay)
+{
+  _journalBytes = 0;
+
+  if (_filename[0] == '\0' || !LittleFS.exists(_filename))
+    return 0;
+
+  fs::File f = LittleFS.open(_filename, FILE_READ);
+  if (!f)
+    return 0;
+
+  const uint32_t fileBytes = f.size();
+
+  // read a page of whole records at a time
+  uint8_t page[s_recordsPerPage * s_recordBytes];
+  int recovered = 0;
+  bool damaged = false;
+
+  while (!damaged)
+  {
+    const size_t got = f.read(page, sizeof(page));
+    const int records = got / s_recordBytes;
+
+    for (int i=0; i < records && !damaged; i++)
+    {
+      CrumbLog::Crumb crumb;
+      if (decode(page + i * s_recordBytes, crumb))
+      {
+        replay(crumb);
+        recovered++;
+      }
+      else
+      {
+        damaged = true;
+      }
+    }
+
+    if (got < sizeof(page))
+    {
+      damaged = damaged || (got % s_recordBytes) != 0;
+      break;
+    }
+  }
+  f.close();
+
+  _journalBytes = recovered * s_recordBytes;
+
+  if (_journalBytes == fileBytes)
+    return recovered;
+
+  // keep the good prefix: copy it aside and swap it in, so a failure part way leaves the original
+  char tempFilename[sizeof(_filename) + 4];
+  snprintf(tempFilename, sizeof(tempFilename), "%s.tmp", _filename);
+
+  fs::File in = LittleFS.open(_filename, FILE_READ);
+  fs::File out = LittleFS.open(tempFilename, FILE_WRITE);
+  bool ok = in && out;
+
+  for (uint32_t copied = 0; ok && copied < _journalBytes; )
+  {
+    const size_t chunk = std::min((uint32_t)sizeof(page), _journalBytes - copied);
+    ok = (in.read(page, chunk) == chunk) && (out.write(page, chunk) == chunk);
+    copied += chunk;
+  }
+
+  if (in)
+    in.close();
+  if (out)
+    out.close();
+
+  if (!ok || !replaceWith(tempFilename))
+  {
+    // appends after a torn record would never be read back, so start afresh
+    LittleFS.remove(tempFilename);
+    LittleFS.remove(_filename);
+    _journalBytes = 0;
+  }
+
+  return recovered;
+}
+
+bool CrumbJournal::replaceWith(const char* tempFilename)
+{
+  return (!LittleFS.exists(_filename) || LittleFS.remove(_filename)) && LittleFS.rename(tempFilename, _filename);
+}
+
+bool CrumbJournal::append(const CrumbLog::Crumb& crumb, const uint32_t nowMs)
+{
+  if (_filename[0] == '\0')
+    return false;
+
+  if (_journalBytes + (_pending + 1) * s_recordBytes > s_maxJournalBytes)
+  {
+    _recordsDropped++;
+    return false;
+  }
+
+  // service() has fallen two pages behind - write here rather than lose the record
+  if (_pending == 2 * s_recordsPerPage && !writePending(_pending))
+  {
+    _recordsDropped++;
+    return false;
+  }
+
+  if (_pending == 0)
+    _oldestPendingMs = nowMs;
+
+  encode(crumb, _batch + _pending * s_recordBytes);
+  _pending++;
+  return true;
+}
+
+bool CrumbJournal::service(const uint32_t nowMs)
+{
+  if (_pending >= s_recordsPerPage)
+    return writePending(s_recordsPerPage);
+
+  if (_pending > 0 && nowMs - _oldestPendingMs >= s_maxPendingMs)
+    return writePending(_pending);
+
+  return false;
+}
+
+bool CrumbJournal::flush()
+{
+  return (_pending == 0 || writePending(_pending));
+}
+
+bool CrumbJournal::writePending(const int records)
+{
+  fs::File f = LittleFS.open(_filename, FILE_APPEND);
+  if (!f)
+    return false;
+
+  const size_t bytes = records * s_recordBytes;
+  const bool ok = (f.write(_batch, bytes) == bytes);
+  f.close();
+
+  if (!ok)
+    return false;
+
+  _journalBytes += bytes;
+  _recordsWritten += records;
+
+  _pending -= records;
+  memmove(_batch, _batch + bytes, _pending * s_recordBytes);
+  return true;
+}
+
+bool CrumbJournal::rotate()
+{
+  if (_filename[0] == '\0')
+    return false;
+
+  // pending records belong to the trail being rotated out
+  flush();
+  _pending = 0;
+
+  if (LittleFS.exists(_rotatedFilename))
+    LittleFS.remove(_rotatedFilename);
+
+  const bool rotated = !LittleFS.exists(_filename) || LittleFS.rename(_filename, _rotatedFilename);
+  _journalBytes = 0;
+  return rotated;
+}
+
+bool CrumbJournal::clear()
+{
+  if (_filename[0] == '\0')
+    return false;
+
+  _pending = 0;
+  _journalBytes = 0;
+  return !LittleFS.exists(_filename) || LittleFS.remove(_filename);
+}
+
+bool CrumbJournal::compact(const std::function<bool(CrumbLog::Crumb&)>& next)
+{
+  if (_filename[0] == '\0')
+    return false;
+
+  // written aside and swapped in, so a brown-out part way leaves the old journal to recover from
+  char tempFilename[sizeof(_filename) + 4];
+  snprintf(tempFilename, sizeof(tempFilename), "%s.tmp", _filename);
+
+  fs::File out = LittleFS.open(tempFilename, FILE_WRITE);
+  if (!out)
+    return false;
+
+  uint8_t page[s_recordsPerPage * s_recordBytes];
+  uint32_t written = 0;
+  bool ok = true;
+  bool more = true;
+
+  while (ok && more)
+  {
+    int records = 0;
+    CrumbLog::Crumb crumb;
+    while (records < s_recordsPerPage && written + (records + 1) * s_recordBytes <= s_maxJournalBytes && (more = next(crumb)))
+      encode(crumb, page + records++ * s_recordBytes);
+
+    const size_t bytes = records * s_recordBytes;
+    ok = (out.write(page, bytes) == bytes);
+    written += bytes;
+
+    // a source bigger than the journal keeps its first s_maxJournalBytes
+    more = more && records == s_recordsPerPage;
+  }
+  out.close();
+
+  if (!ok || !replaceWith(tempFilename))
+  {
+    LittleFS.remove(tempFilename);
+    return false;
+  }
+
+  // pending records are in the source the journal was rebuilt from
+  _pending = 0;
+  _journalBytes = written;
+  return true;
+}
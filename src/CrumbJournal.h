@@ -0,0 +1,72 @@
+#ifndef CrumbJournal_h
+#define CrumbJournal_h
+
+#include <stdint.h>
+#include <functional>
+
+#include "CrumbLog.h"
+
+/* Append-only journal of crumbs on LittleFS, so a trail survives a brown-out.
+ *
+ * append() only copies an 18-byte record (marker, crumb, CRC-16) into a RAM
+ * batch; service() writes whole pages of records from the idle path, or
+ * whatever is pending once the oldest record is s_maxPendingMs old, so at most
+ * half a minute of trail is at risk while most writes are a full page.
+ *
+ * recover() replays every record up to the first bad CRC or torn tail,
+ * rewriting the file without the damaged tail. rotate() renames the journal
+ * aside rather than rewriting it, and clear() deletes it. Once the journal
+ * reaches s_maxJournalBytes appends are dropped; compact() rewrites it from
+ * the caller's current set of records, which is always smaller.
+ */
+class CrumbJournal
+{
+  public:
+    static const int s_recordBytes = 18;
+    static const int s_pageBytes = 256;
+    static const int s_recordsPerPage = s_pageBytes / s_recordBytes;
+    static const uint32_t s_maxPendingMs = 30000;
+    static const uint32_t s_maxJournalBytes = 512 * 1024;
+
+    CrumbJournal();
+
+    void begin(const char* filename, const char* rotatedFilename);
+
+    int recover(const std::function<void(const CrumbLog::Crumb&)>& replay);
+
+    bool append(const CrumbLog::Crumb& crumb, const uint32_t nowMs);
+    bool service(const uint32_t nowMs);
+    bool flush();
+    bool rotate();
+    bool clear();
+
+    // next() fills in each record to keep and returns false after the last
+    bool compact(const std::function<bool(CrumbLog::Crumb&)>& next);
+
+    bool isFull() const                 { return _journalBytes + (_pending + 1) * s_recordBytes > s_maxJournalBytes; }
+
+    int pendingRecords() const          { return _pending; }
+    uint32_t journalBytes() const       { return _journalBytes; }
+    uint32_t recordsWritten() const     { return _recordsWritten; }
+    uint32_t recordsDropped() const     { return _recordsDropped; }
+
+  private:
+    static void encode(const CrumbLog::Crumb& crumb, uint8_t* record);
+    static bool decode(const uint8_t* record, CrumbLog::Crumb& crumb);
+    bool writePending(const int records);
+    bool replaceWith(const char* tempFilename);
+
+    char _filename[32];
+    char _rotatedFilename[32];
+
+    // two pages, so a flush that is late by a page still doesn't block the render path
+    uint8_t _batch[2 * s_recordsPerPage * s_recordBytes];
+    int _pending;
+    uint32_t _oldestPendingMs;
+
+    uint32_t _journalBytes;
+    uint32_t _recordsWritten;
+    uint32_t _recordsDropped;
+};
+
+#endif
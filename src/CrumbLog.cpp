@@ -0,0 +1,480 @@
+#include "CrumbLog.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#include "PsramAlloc.h"
+#include "DouglasPeucker.h"
+
+static const uint8_t s_flagKeyframe = 0x80;
+static const uint8_t s_flagLat = 0x01;
+static const uint8_t s_flagLng = 0x02;
+static const uint8_t s_flagHeading = 0x04;
+static const uint8_t s_flagDepth = 0x08;
+static const uint8_t s_flagInterval = 0x10;
+
+static const int s_maxRecordBytes = 32;
+
+// tolerance doubles per level, so level 8 is 128x the base
+static const int s_maxThinningLevel = 8;
+
+// scratch for one thinning step - two source segments decode to at most this many crumbs
+static const int s_maxThinCrumbs = 2 * CrumbLog::s_segmentCrumbs;
+static CrumbLog::Crumb s_thinCrumbs[s_maxThinCrumbs];
+static float s_thinE[s_maxThinCrumbs];
+static float s_thinN[s_maxThinCrumbs];
+static bool s_thinKeep[s_maxThinCrumbs];
+static int32_t s_thinStack[s_maxThinCrumbs][2];
+static uint8_t s_thinRecords[CrumbLog::s_segmentCrumbs * s_maxRecordBytes];
+
+static inline uint32_t zigzag(const int32_t v)       { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+static inline int32_t unzigzag(const uint32_t v)     { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+static inline int putVarint(uint8_t* p, uint32_t v)
+{
+  int n = 0;
+  while (v >= 0x80)
+  {
+    p[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  p[n++] = (uint8_t)v;
+  return n;
+}
+
+static inline uint32_t getVarint(const uint8_t* p, uint32_t& offset)
+{
+  uint32_t v = 0;
+  int shift = 0;
+  uint8_t b;
+  do
+  {
+    b = p[offset++];
+    v |= (uint32_t)(b & 0x7F) << shift;
+    shift += 7;
+  } while (b & 0x80);
+  return v;
+}
+
+CrumbLog::Crumb CrumbLog::Crumb::fromDegrees(const double lat, const double lng, const double heading, const double depth, const uint32_t timeMs)
+{
+  double wrapped = fmod(heading, 360.0);
+  if (wrapped < 0)
+    wrapped += 360.0;
+
+  Crumb c;
+  c.latE6 = (int32_t)lround(lat * 1e6);
+  c.lngE6 = (int32_t)lround(lng * 1e6);
+  c.heading = (uint8_t)((int)lround(wrapped * 256.0 / 360.0) & 0xFF);
+  c.depthDm = (int16_t)lround(fmin(fmax(depth * 10.0, -32768.0), 32767.0));
+  c.timeMs = timeMs;
+  return c;
+}
+
+int CrumbLog::Codec::encode(const Crumb& crumb, const bool keyframe, uint8_t* record)
+{
+  int n = 1;
+  uint8_t flags = 0;
+  Crumb stored = crumb;
+
+  if (keyframe)
+  {
+    flags = s_flagKeyframe;
+    n += putVarint(record + n, zigzag(crumb.latE6));
+    n += putVarint(record + n, zigzag(crumb.lngE6));
+    n += putVarint(record + n, crumb.timeMs);
+    record[n++] = crumb.heading;
+    n += putVarint(record + n, zigzag(crumb.depthDm));
+    _velLat = _velLng = _intervalS = 0;
+  }
+  else
+  {
+    const int32_t dLat = crumb.latE6 - _prev.latE6;
+    const int32_t dLng = crumb.lngE6 - _prev.lngE6;
+    const int8_t dHeading = (int8_t)(uint8_t)(crumb.heading - _prev.heading);
+    const int32_t dDepth = crumb.depthDm - _prev.depthDm;
+
+    // intervals are whole seconds from the reconstructed previous time, so GPS timing jitter doesn't cost
+    // a byte per crumb and rounding never accumulates
+    const int32_t elapsedMs = (int32_t)(crumb.timeMs - _prev.timeMs);
+    const int32_t intervalS = (elapsedMs >= 0 ? elapsedMs + 500 : elapsedMs - 500) / 1000;
+    stored.timeMs = _prev.timeMs + intervalS * 1000;
+
+    if (dLat != _velLat)            { flags |= s_flagLat;      n += putVarint(record + n, zigzag(dLat - _velLat)); }
+    if (dLng != _velLng)            { flags |= s_flagLng;      n += putVarint(record + n, zigzag(dLng - _velLng)); }
+    if (dHeading != 0)              { flags |= s_flagHeading;  n += putVarint(record + n, zigzag(dHeading)); }
+    if (dDepth != 0)                { flags |= s_flagDepth;    n += putVarint(record + n, zigzag(dDepth)); }
+    if (intervalS != _intervalS)    { flags |= s_flagInterval; n += putVarint(record + n, zigzag(intervalS - _intervalS)); }
+
+    _velLat = dLat;
+    _velLng = dLng;
+    _intervalS = intervalS;
+  }
+  record[0] = flags;
+
+  _prev = stored;
+  return n;
+}
+
+void CrumbLog::Codec::decode(const uint8_t* p, uint32_t& offset, Crumb& crumb)
+{
+  const uint8_t flags = p[offset++];
+
+  if (flags & s_flagKeyframe)
+  {
+    crumb.latE6 = unzigzag(getVarint(p, offset));
+    crumb.lngE6 = unzigzag(getVarint(p, offset));
+    crumb.timeMs = getVarint(p, offset);
+    crumb.heading = p[offset++];
+    crumb.depthDm = (int16_t)unzigzag(getVarint(p, offset));
+    _velLat = _velLng = _intervalS = 0;
+  }
+  else
+  {
+    const int32_t ddLat = (flags & s_flagLat) ? unzigzag(getVarint(p, offset)) : 0;
+    const int32_t ddLng = (flags & s_flagLng) ? unzigzag(getVarint(p, offset)) : 0;
+    const int32_t dHeading = (flags & s_flagHeading) ? unzigzag(getVarint(p, offset)) : 0;
+    const int32_t dDepth = (flags & s_flagDepth) ? unzigzag(getVarint(p, offset)) : 0;
+    const int32_t ddIntervalS = (flags & s_flagInterval) ? unzigzag(getVarint(p, offset)) : 0;
+
+    _velLat += ddLat;
+    _velLng += ddLng;
+    _intervalS += ddIntervalS;
+
+    crumb.latE6 = _prev.latE6 + _velLat;
+    crumb.lngE6 = _prev.lngE6 + _velLng;
+    crumb.heading = (uint8_t)(_prev.heading + dHeading);
+    crumb.depthDm = (int16_t)(_prev.depthDm + dDepth);
+    crumb.timeMs = _prev.timeMs + _intervalS * 1000;
+  }
+
+  _prev = crumb;
+}
+
+CrumbLog::CrumbLog() : _buffer(nullptr), _budget(0), _writeOffset(0), _segmentCount(0), _count(0), _full(false),
+                       _thinToleranceMetres(0), _fullResolutionCrumbs(0), _thinning(false), _thinSegment(0),
+                       _thinWriteOffset(0), _thinTriggerBytes(0), _thinnedCrumbs(0), _thinningPasses(0)
+{
+}
+
+CrumbLog::~CrumbLog()
+{
+  release();
+}
+
+bool CrumbLog::allocate(const uint32_t budgetBytes)
+{
+  release();
+
+  _buffer = (uint8_t*)psramMalloc(budgetBytes);
+  if (_buffer == nullptr)
+    return false;
+
+  _budget = budgetBytes;
+  clear();
+  return true;
+}
+
+void CrumbLog::release()
+{
+  if (_buffer)
+    psramFree(_buffer);
+
+  _buffer = nullptr;
+  _budget = 0;
+  clear();
+}
+
+void CrumbLog::clear()
+{
+  _writeOffset = 0;
+  _segmentCount = 0;
+  _count = 0;
+  _full = false;
+  _codec = Codec();
+
+  _thinning = false;
+  _thinTriggerBytes = _budget / 4 * 3;
+  _thinnedCrumbs = 0;
+  _thinningPasses = 0;
+}
+
+void CrumbLog::setThinning(const float toleranceMetres, const int fullResolutionCrumbs)
+{
+  _thinToleranceMetres = toleranceMetres;
+  _fullResolutionCrumbs = fullResolutionCrumbs;
+}
+
+CrumbLog::Segment CrumbLog::segment(const int k) const
+{
+  Segment s;
+  memcpy(&s, _buffer + _budget - (k + 1) * sizeof(Segment), sizeof(s));
+  return s;
+}
+
+void CrumbLog::setSegment(const int k, const Segment& s)
+{
+  memcpy(_buffer + _budget - (k + 1) * sizeof(Segment), &s, sizeof(s));
+}
+
+void CrumbLog::removeSegment(const int k)
+{
+  // the table grows down, so later entries move up one slot
+  uint8_t* lowest = _buffer + _budget - _segmentCount * sizeof(Segment);
+  memmove(lowest + sizeof(Segment), lowest, (_segmentCount - k - 1) * sizeof(Segment));
+  _segmentCount--;
+}
+
+int CrumbLog::decodeSegment(const int k, Crumb* out) const
+{
+  const Segment s = segment(k);
+  uint32_t offset = s.offset;
+  Codec codec;
+  for (int i=0; i < s.count; i++)
+    codec.decode(_buffer, offset, out[i]);
+  return s.count;
+}
+
+bool CrumbLog::append(const Crumb& crumb)
+{
+  if (_buffer == nullptr || _full)
+    return false;
+
+  const bool keyframe = (_segmentCount == 0 || segment(_segmentCount-1).count >= s_segmentCrumbs);
+
+  uint8_t record[s_maxRecordBytes];
+  Codec codec = _codec;
+  const int n = codec.encode(crumb, keyframe, record);
+
+  const uint32_t tableBytes = (_segmentCount + (keyframe ? 1 : 0)) * sizeof(Segment);
+  if (_writeOffset + n + tableBytes > _budget)
+  {
+    _full = true;
+    return false;
+  }
+
+  if (keyframe)
+  {
+    Segment s;
+    s.offset = _writeOffset;
+    s.count = 0;
+    s.level = 0;
+    s.reserved = 0;
+    setSegment(_segmentCount++, s);
+  }
+
+  Segment last = segment(_segmentCount-1);
+  last.count++;
+  setSegment(_segmentCount-1, last);
+
+  memcpy(_buffer + _writeOffset, record, n);
+  _writeOffset += n;
+  _codec = codec;
+  _count++;
+  return true;
+}
+
+bool CrumbLog::get(const int i, Crumb& crumb) const
+{
+  if (i < 0 || i >= _count)
+    return false;
+
+  Iterator it(*this, i);
+  return it.next(crumb);
+}
+
+bool CrumbLog::segmentData(const int k, const uint8_t*& data, uint32_t& bytes, int& crumbs) const
+{
+  if (k < 0 || k >= _segmentCount)
+    return false;
+
+  const Segment s = segment(k);
+
+  // mid-pass, the rewritten segments end at _thinWriteOffset rather than where the next one starts
+  uint32_t end;
+  if (k == _segmentCount - 1)
+    end = _writeOffset;
+  else if (_thinning && k == _thinSegment - 1)
+    end = _thinWriteOffset;
+  else
+    end = segment(k+1).offset;
+
+  data = _buffer + s.offset;
+  bytes = end - s.offset;
+  crumbs = s.count;
+  return true;
+}
+
+int CrumbLog::firstRecentSegment() const
+{
+  // the open segment is always protected - the encoder state depends on it
+  int k = _segmentCount - 1;
+  int recent = segment(k).count;
+  while (k > 0 && recent < _fullResolutionCrumbs)
+    recent += segment(--k).count;
+  return k;
+}
+
+bool CrumbLog::thinStep(const SiteFrame& frame)
+{
+  if (_buffer == nullptr || _thinToleranceMetres <= 0 || !frame.isSet() || _segmentCount < 2)
+    return false;
+
+  if (!_thinning)
+  {
+    if (usedBytes() < _thinTriggerBytes)
+      return false;
+
+    _thinning = true;
+    _thinSegment = 0;
+    _thinWriteOffset = segment(0).offset;
+  }
+
+  const int k = _thinSegment;
+  const int recent = firstRecentSegment();
+  if (k >= recent)
+  {
+    finishThinningPass();
+    return true;
+  }
+
+  // merge with the next segment when the result still fits one segment
+  const Segment first = segment(k);
+  const Segment second = (k + 1 < recent ? segment(k+1) : first);
+  const int sources = (k + 1 < recent && first.count + second.count <= s_segmentCrumbs ? 2 : 1);
+
+  int count = decodeSegment(k, s_thinCrumbs);
+  if (sources == 2)
+    count += decodeSegment(k+1, s_thinCrumbs + count);
+
+  // segments from _thinSegment on are contiguous, so the source ends where the next one starts
+  const uint32_t sourceBytes = segment(k + sources).offset - first.offset;
+
+  const int level = std::min(std::max(first.level, (sources == 2 ? second.level : first.level)) + 1, s_maxThinningLevel);
+  const float tolerance = _thinToleranceMetres * (1 << (level - 1));
+
+  const double metresPerE6Lat = frame.metresPerDegreeLat() * 1e-6;
+  const double metresPerE6Long = frame.metresPerDegreeLong() * 1e-6;
+  for (int i=0; i < count; i++)
+  {
+    s_thinE[i] = (float)((s_thinCrumbs[i].lngE6 - s_thinCrumbs[0].lngE6) * metresPerE6Long);
+    s_thinN[i] = (float)((s_thinCrumbs[i].latE6 - s_thinCrumbs[0].latE6) * metresPerE6Lat);
+  }
+
+  const int kept = douglasPeucker(s_thinE, s_thinN, count, tolerance, s_thinKeep, s_thinStack);
+
+  Codec codec;
+  uint32_t bytes = 0;
+  for (int i=0; i < count && bytes <= sourceBytes; i++)
+  {
+    if (s_thinKeep[i])
+      bytes += codec.encode(s_thinCrumbs[i], bytes == 0, s_thinRecords + bytes);
+  }
+
+  if (bytes <= sourceBytes)
+  {
+    // the rewrite never overtakes unread data: it lands at or before the source and is no longer
+    memcpy(_buffer + _thinWriteOffset, s_thinRecords, bytes);
+
+    Segment s;
+    s.offset = _thinWriteOffset;
+    s.count = (uint8_t)kept;
+    s.level = (uint8_t)level;
+    s.reserved = 0;
+    setSegment(k, s);
+    if (sources == 2)
+      removeSegment(k+1);
+
+    _thinWriteOffset += bytes;
+    _thinSegment = k + 1;
+    _count -= (count - kept);
+    _thinnedCrumbs += (count - kept);
+  }
+  else
+  {
+    // re-encoding grew the data - rare, but keep the segment as it was
+    memmove(_buffer + _thinWriteOffset, _buffer + first.offset, segment(k+1).offset - first.offset);
+
+    Segment s = first;
+    s.offset = _thinWriteOffset;
+    setSegment(k, s);
+
+    _thinWriteOffset += segment(k+1).offset - first.offset;
+    _thinSegment = k + 1;
+  }
+
+  return true;
+}
+
+void CrumbLog::finishThinningPass()
+{
+  // close the gap left by the rewrite by sliding the untouched recent segments down
+  const uint32_t tailOffset = segment(_thinSegment).offset;
+  const uint32_t gap = tailOffset - _thinWriteOffset;
+
+  memmove(_buffer + _thinWriteOffset, _buffer + tailOffset, _writeOffset - tailOffset);
+  for (int k=_thinSegment; k < _segmentCount; k++)
+  {
+    Segment s = segment(k);
+    s.offset -= gap;
+    setSegment(k, s);
+  }
+  _writeOffset -= gap;
+
+  // wait for a further 1/16 of the budget before the next pass, in case this one freed little
+  _thinTriggerBytes = std::max(_budget / 4 * 3, usedBytes() + _budget / 16);
+  _thinning = false;
+  _full = false;
+  _thinningPasses++;
+}
+
+CrumbLog::Iterator::Iterator(const CrumbLog& log, const int startIndex) : _log(&log), _index(0), _segment(-1), _remaining(0),
+                                                                         _segmentCrumbs(0), _offset(0)
+{
+  if (startIndex >= log._count)
+  {
+    _log = nullptr;     // nothing to iterate
+    return;
+  }
+
+  if (startIndex <= 0)
+    return;
+
+  // skip whole segments, then decode forward within the one holding startIndex
+  while (_segment + 1 < log._segmentCount && _index + log.segment(_segment + 1).count <= startIndex)
+    _index += (_segmentCrumbs = log.segment(++_segment).count);
+
+  Crumb skipped;
+  while (_index < startIndex && next(skipped))
+    ;
+}
+
+bool CrumbLog::Iterator::next(Crumb& crumb)
+{
+  if (_log == nullptr || _index >= _log->_count)
+    return false;
+
+  if (_remaining == 0)
+  {
+    // crumbs appended to the open segment since it was entered come before the next segment
+    const int appended = (_segment >= 0 ? _log->segment(_segment).count - _segmentCrumbs : 0);
+    if (appended > 0)
+    {
+      _remaining = appended;
+    }
+    else
+    {
+      const Segment s = _log->segment(++_segment);
+      _offset = s.offset;
+      _remaining = s.count;
+      _segmentCrumbs = 0;
+    }
+    _segmentCrumbs += _remaining;
+  }
+
+  _codec.decode(_log->_buffer, _offset, crumb);
+  _remaining--;
+  _index++;
+  return true;
+}
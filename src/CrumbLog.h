@@ -0,0 +1,161 @@
+#ifndef CrumbLog_h
+#define CrumbLog_h
+
+#include <stdint.h>
+
+#include "SiteFrame.h"
+
+/* Append-only, delta-encoded breadcrumb log.
+ *
+ * Successive crumbs are metres apart, so each is stored as zig-zag varints:
+ *   - position as the change in velocity (delta of delta) in micro-degrees
+ *   - heading as the change in 256ths of a turn
+ *   - depth as the change in decimetres
+ *   - time as the change in interval, in whole seconds
+ * preceded by one flags byte that elides any field that is zero. At a steady
+ * drop rate that is about 3.3 bytes per crumb on a smooth track and 4.2 with
+ * metre-level GPS noise, without depth; 4-5 with it.
+ *
+ * Crumbs are grouped into segments of up to 64, each starting with a keyframe
+ * holding absolute values. A table of segment offsets and counts grows down from
+ * the end of the same buffer, so random access decodes at most 63 crumbs.
+ * Rendering should use the forward iterator, which decodes each crumb once.
+ *
+ * With thinning enabled the log never fills: once it is three quarters full,
+ * thinStep() rewrites old segments in place, one or two per call. Each rewrite
+ * runs Douglas-Peucker in site-local metres, merging neighbouring segments and
+ * doubling the tolerance at each level, so the most recent crumbs keep full
+ * resolution and older ones thin progressively while turns are kept. Iterators
+ * are invalidated by thinStep().
+ */
+class CrumbLog
+{
+  public:
+    class Crumb
+    {
+      public:
+        Crumb() : latE6(0), lngE6(0), timeMs(0), depthDm(0), heading(0) {}
+
+        int32_t latE6;
+        int32_t lngE6;
+        uint32_t timeMs;
+        int16_t depthDm;
+        uint8_t heading;      // 256ths of a turn
+
+        static Crumb fromDegrees(const double lat, const double lng, const double heading, const double depth, const uint32_t timeMs);
+        double lat() const          { return latE6 * 1e-6; }
+        double lng() const          { return lngE6 * 1e-6; }
+        double headingDegrees() const { return heading * 360.0 / 256.0; }
+        double depthMetres() const  { return depthDm / 10.0; }
+    };
+
+  private:
+    // delta state shared by the encoder and decoder, reset at each keyframe
+    class Codec
+    {
+      public:
+        Codec() : _velLat(0), _velLng(0), _intervalS(0) {}
+
+        int encode(const Crumb& crumb, const bool keyframe, uint8_t* record);
+        void decode(const uint8_t* buffer, uint32_t& offset, Crumb& crumb);
+
+      private:
+        Crumb _prev;
+        int32_t _velLat;
+        int32_t _velLng;
+        int32_t _intervalS;
+    };
+
+    class Segment
+    {
+      public:
+        uint32_t offset;
+        uint8_t count;
+        uint8_t level;        // times thinned, 0 for full resolution
+        uint16_t reserved;
+    };
+
+  public:
+    class Iterator
+    {
+      public:
+        Iterator() : _log(nullptr), _index(0), _segment(-1), _remaining(0), _segmentCrumbs(0), _offset(0) {}
+
+        bool next(Crumb& crumb);
+        int index() const { return _index; }
+
+      private:
+        friend class CrumbLog;
+        Iterator(const CrumbLog& log, const int startIndex);
+
+        const CrumbLog* _log;
+        int _index;
+        int _segment;
+        int _remaining;
+        int _segmentCrumbs;   // of _segment, when last looked at
+        uint32_t _offset;
+        Codec _codec;
+    };
+
+    static const int s_segmentCrumbs = 64;
+
+    CrumbLog();
+    ~CrumbLog();
+
+    bool allocate(const uint32_t budgetBytes);
+    void release();
+    void clear();
+
+    bool append(const Crumb& crumb);
+
+    int size() const                  { return _count; }
+    bool get(const int i, Crumb& crumb) const;
+
+    // from(i) with i at or past size() yields nothing
+    Iterator begin() const            { return Iterator(*this, 0); }
+    Iterator from(const int i) const  { return Iterator(*this, i); }
+
+    // raw encoded segments, each self-contained from its keyframe - for export without decoding
+    int segmentCount() const          { return _segmentCount; }
+    bool segmentData(const int k, const uint8_t*& data, uint32_t& bytes, int& crumbs) const;
+
+    uint32_t usedBytes() const        { return _writeOffset + _segmentCount * sizeof(Segment); }
+    uint32_t budgetBytes() const      { return _budget; }
+    bool full() const                 { return _full; }
+
+    // toleranceMetres 0 disables thinning, so the log stops when full
+    void setThinning(const float toleranceMetres, const int fullResolutionCrumbs);
+    bool thinStep(const SiteFrame& frame);
+    bool isThinning() const           { return _thinning; }
+
+    uint32_t thinnedCrumbs() const    { return _thinnedCrumbs; }
+    uint32_t thinningPasses() const   { return _thinningPasses; }
+
+  private:
+    Segment segment(const int k) const;
+    void setSegment(const int k, const Segment& s);
+    void removeSegment(const int k);
+    int decodeSegment(const int k, Crumb* out) const;
+    int firstRecentSegment() const;
+    void finishThinningPass();
+
+    uint8_t* _buffer;
+    uint32_t _budget;
+    uint32_t _writeOffset;
+    int _segmentCount;
+    int _count;
+    bool _full;
+    Codec _codec;
+
+    // thinning pass state: segments before _thinSegment are rewritten and end at _thinWriteOffset
+    float _thinToleranceMetres;
+    int _fullResolutionCrumbs;
+    bool _thinning;
+    int _thinSegment;
+    uint32_t _thinWriteOffset;
+    uint32_t _thinTriggerBytes;
+    uint32_t _thinnedCrumbs;
+    uint32_t _thinningPasses;
+};
+
+#endif
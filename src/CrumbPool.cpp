@@ -0,0 +1,137 @@
+#include "CrumbPool.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "PsramAlloc.h"
+
+static const uint64_t s_latMask = (1ull << 28) - 1;
+static const uint64_t s_longMask = (1ull << 29) - 1;
+static const int s_longShift = 28;
+static const int s_timeShift = 57;
+static const uint32_t s_maxTimeDelta = 127;
+
+CrumbPool::CrumbPool() : _records(nullptr), _blockTimesMs(nullptr), _capacity(0), _count(0), _lastTimeMs(0)
+{
+}
+
+CrumbPool::~CrumbPool()
+{
+  release();
+}
+
+void CrumbPool::release()
+{
+  if (_records)
+    psramFree(_records);
+  if (_blockTimesMs)
+    psramFree(_blockTimesMs);
+
+  _records = nullptr;
+  _blockTimesMs = nullptr;
+  _capacity = _count = 0;
+}
+
+bool CrumbPool::allocate(const int capacity)
+{
+  release();
+
+  if (capacity <= 0)
+    return false;
+
+  _records = (uint8_t*)psramMalloc((size_t)capacity * s_recordBytes);
+  _blockTimesMs = (uint32_t*)psramMalloc((((size_t)capacity >> s_blockShift) + 1) * sizeof(uint32_t));
+
+  if (_records == nullptr || _blockTimesMs == nullptr)
+  {
+    release();
+    return false;
+  }
+
+  _capacity = capacity;
+  return true;
+}
+
+bool CrumbPool::push(const double lat, const double lng, const double heading, const double depth, const uint32_t timeMs)
+{
+  if (_count >= _capacity)
+    return false;
+
+  const int32_t latE6 = (int32_t)lround(lat * 1e6);
+  const int32_t lngE6 = (int32_t)lround(lng * 1e6);
+
+  // deltas are taken from the reconstructed time of the previous record so rounding doesn't accumulate
+  uint32_t timeDelta = 0;
+  if ((_count & ((1 << s_blockShift) - 1)) == 0)
+  {
+    _blockTimesMs[_count >> s_blockShift] = timeMs;
+    _lastTimeMs = timeMs;
+  }
+  else
+  {
+    timeDelta = (timeMs - _lastTimeMs + 500) / 1000;
+    if (timeDelta > s_maxTimeDelta)
+      timeDelta = s_maxTimeDelta;
+    _lastTimeMs += timeDelta * 1000;
+  }
+
+  const uint64_t position = ((uint64_t)(uint32_t)latE6 & s_latMask) |
+                            (((uint64_t)(uint32_t)lngE6 & s_longMask) << s_longShift) |
+                            ((uint64_t)timeDelta << s_timeShift);
+
+  double wrapped = fmod(heading, 360.0);
+  if (wrapped < 0)
+    wrapped += 360.0;
+
+  const double clampedDepth = fmin(fmax(depth * 10.0, -32768.0), 32767.0);
+  const int16_t depthDm = (int16_t)lround(clampedDepth);
+  const uint8_t headingQ = (uint8_t)((int)lround(wrapped * 256.0 / 360.0) & 0xFF);
+
+  uint8_t* r = _records + (size_t)_count * s_recordBytes;
+  memcpy(r, &position, sizeof(position));
+  memcpy(r + 8, &depthDm, sizeof(depthDm));
+  r[10] = headingQ;
+
+  _count++;
+  return true;
+}
+
+void CrumbPool::getE6(const int i, int32_t& latE6, int32_t& lngE6) const
+{
+  uint64_t position;
+  memcpy(&position, _records + (size_t)i * s_recordBytes, sizeof(position));
+
+  // sign-extend the 28 and 29 bit fields
+  latE6 = (int32_t)((uint32_t)(position & s_latMask) << 4) >> 4;
+  lngE6 = (int32_t)((uint32_t)((position >> s_longShift) & s_longMask) << 3) >> 3;
+}
+
+void CrumbPool::get(const int i, double& lat, double& lng, double& heading, double& depth) const
+{
+  int32_t latE6, lngE6;
+  getE6(i, latE6, lngE6);
+
+  const uint8_t* r = _records + (size_t)i * s_recordBytes;
+  int16_t depthDm;
+  memcpy(&depthDm, r + 8, sizeof(depthDm));
+
+  lat = latE6 * 1e-6;
+  lng = lngE6 * 1e-6;
+  depth = depthDm / 10.0;
+  heading = r[10] * 360.0 / 256.0;
+}
+
+uint32_t CrumbPool::timestampMs(const int i) const
+{
+  const int blockStart = i & ~((1 << s_blockShift) - 1);
+  uint32_t t = _blockTimesMs[i >> s_blockShift];
+
+  for (int k = blockStart + 1; k <= i; k++)
+  {
+    uint64_t position;
+    memcpy(&position, _records + (size_t)k * s_recordBytes, sizeof(position));
+    t += (uint32_t)(position >> s_timeShift) * 1000;
+  }
+
+  return t;
+}
@@ -0,0 +1,51 @@
+#ifndef CrumbPool_h
+#define CrumbPool_h
+
+#include <stdint.h>
+
+/* Fixed-capacity store of packed breadcrumb/pin records.
+ *
+ * Each record is 11 bytes instead of the 32 of four doubles:
+ *   - latitude and longitude in micro-degrees (~0.1m), as 28 and 29 bit two's complement
+ *   - seconds since the previous record in the remaining 7 bits, saturating at 127
+ *   - depth in decimetres as int16
+ *   - heading in 256ths of a turn (~1.4 degrees)
+ * Every 64th record also has its absolute time kept alongside, so timestamps
+ * are exact at block starts and only drift if a gap inside a block exceeds 127s.
+ *
+ * Storage comes from PSRAM when the board has it and is sized at allocate().
+ */
+class CrumbPool
+{
+  public:
+    static const int s_recordBytes = 11;
+
+    CrumbPool();
+    ~CrumbPool();
+
+    bool allocate(const int capacity);
+    void release();
+
+    bool push(const double lat, const double lng, const double heading, const double depth, const uint32_t timeMs);
+    void clear()                  { _count = 0; }
+
+    void get(const int i, double& lat, double& lng, double& heading, double& depth) const;
+    void getE6(const int i, int32_t& latE6, int32_t& lngE6) const;
+    uint32_t timestampMs(const int i) const;
+
+    int size() const              { return _count; }
+    int capacity() const          { return _capacity; }
+    bool full() const             { return _count >= _capacity; }
+    uint32_t sizeBytes() const    { return (uint32_t)_capacity * s_recordBytes; }
+
+  private:
+    static const int s_blockShift = 6;      // absolute time kept every 64 records
+
+    uint8_t* _records;
+    uint32_t* _blockTimesMs;
+    int _capacity;
+    int _count;
+    uint32_t _lastTimeMs;     // reconstructed time of the last record
+};
+
+#endif
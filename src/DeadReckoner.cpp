@@ -0,0 +1,87 @@
+#include "DeadReckoner.h"
+
+#include <math.h>
+#include <algorithm>
+
+namespace
+{
+  // a turn from one heading to another the short way round, -180..180
+  float headingChange(const float from, const float to)
+  {
+    return fmodf(to - from + 540.0f, 360.0f) - 180.0f;
+  }
+
+  // weight of the newest measurement in the velocity and turn rate
+  const float s_smoothing = 0.5f;
+}
+
+DeadReckoner::DeadReckoner()
+{
+  reset();
+}
+
+void DeadReckoner::reset()
+{
+  _fix = SiteFrame::point();
+  _fixHeading = 0;
+  _fixMs = 0;
+  _fixes = 0;
+  _velocityE = _velocityN = 0;
+  _turnRate = 0;
+  _correction = SiteFrame::point();
+  _headingCorrection = 0;
+}
+
+float DeadReckoner::speed() const
+{
+  return hypotf(_velocityE, _velocityN);
+}
+
+void DeadReckoner::addFix(const SiteFrame::point p, const float heading, const uint32_t ms)
+{
+  // where the diver is on screen right now, before this fix moves the track
+  SiteFrame::point shown = p;
+  float shownHeading = heading;
+  const bool wasShown = estimate(ms, shown, shownHeading);
+
+  const uint32_t gap = ms - _fixMs;
+  if (_fixes == 0 || gap == 0 || gap > s_maxFixGapMs)
+  {
+    _velocityE = _velocityN = 0;
+    _turnRate = 0;
+  }
+  else
+  {
+    const float seconds = gap / 1000.0f;
+    _velocityE += s_smoothing * ((p.e - _fix.e) / seconds - _velocityE);
+    _velocityN += s_smoothing * ((p.n - _fix.n) / seconds - _velocityN);
+    _turnRate += s_smoothing * (headingChange(_fixHeading, heading) / seconds - _turnRate);
+  }
+
+  // the icon carries on from where it was, easing onto the track from this fix
+  _correction = (wasShown ? SiteFrame::point(shown.e - p.e, shown.n - p.n) : SiteFrame::point());
+  _headingCorrection = (wasShown ? headingChange(heading, shownHeading) : 0);
+
+  _fix = p;
+  _fixHeading = heading;
+  _fixMs = ms;
+  _fixes++;
+}
+
+bool DeadReckoner::estimate(const uint32_t ms, SiteFrame::point& p, float& heading) const
+{
+  if (_fixes == 0)
+    return false;
+
+  const uint32_t since = ms - _fixMs;
+  const float seconds = std::min(since, s_maxExtrapolationMs) / 1000.0f;
+  const float fade = (since < s_correctionMs ? 1.0f - (float)since / s_correctionMs : 0.0f);
+
+  p.e = _fix.e + _velocityE * seconds + _correction.e * fade;
+  p.n = _fix.n + _velocityN * seconds + _correction.n * fade;
+
+  heading = fmodf(_fixHeading + _turnRate * seconds + _headingCorrection * fade + 360.0f, 360.0f);
+  if (heading < 0)
+    heading += 360.0f;
+  return true;
+}
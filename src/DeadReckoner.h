@@ -0,0 +1,50 @@
+#ifndef DeadReckoner_h
+#define DeadReckoner_h
+
+#include <stdint.h>
+
+#include "SiteFrame.h"
+
+/* Where to show the diver between fixes, so frames can come faster than the
+ * GPS.
+ *
+ * Velocity and turn rate are estimated from successive fixes, smoothed so one
+ * noisy fix doesn't throw the diver across the screen. Between fixes the
+ * position runs on from the last fix at that velocity, for up to
+ * s_maxExtrapolationMs. When a fix lands, the gap between where the diver was
+ * being shown and the fix becomes a correction that fades out over
+ * s_correctionMs, so the icon eases onto the new track instead of jumping.
+ */
+class DeadReckoner
+{
+  public:
+    static const uint32_t s_maxExtrapolationMs = 1500;
+    static const uint32_t s_correctionMs = 500;
+    static const uint32_t s_maxFixGapMs = 5000;      // longer between fixes and the velocity starts again from rest
+
+    DeadReckoner();
+
+    void reset();
+    void addFix(const SiteFrame::point p, const float heading, const uint32_t ms);
+
+    // position and heading to show at ms; false before the first fix
+    bool estimate(const uint32_t ms, SiteFrame::point& p, float& heading) const;
+
+    bool hasFix() const             { return _fixes > 0; }
+    float speed() const;            // metres a second
+
+  private:
+    SiteFrame::point _fix;
+    float _fixHeading;
+    uint32_t _fixMs;
+    int _fixes;
+
+    float _velocityE;               // metres a second
+    float _velocityN;
+    float _turnRate;                // degrees a second
+
+    SiteFrame::point _correction;   // shown minus fix when the fix landed
+    float _headingCorrection;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef DouglasPeucker_h
+#define DouglasPeucker_h
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+
+/* Douglas-Peucker line simplification over planar points, in whatever units the
+ * tolerance is given in. Iterative, with a caller-supplied stack of at least
+ * count entries, so it neither recurses nor allocates. The endpoints are always
+ * kept; returns the number of points kept.
+ */
+
+// distance from p to the line segment a-b, so a path doubling back on itself still counts as a turn
+inline float distanceToSegment(const float px, const float py, const float ax, const float ay, const float bx, const float by)
+{
+  const float dx = bx - ax;
+  const float dy = by - ay;
+  const float lengthSq = dx*dx + dy*dy;
+
+  float t = (lengthSq > 0 ? ((px - ax) * dx + (py - ay) * dy) / lengthSq : 0);
+  t = std::max(0.0f, std::min(1.0f, t));
+
+  return hypotf(px - (ax + t * dx), py - (ay + t * dy));
+}
+
+inline int douglasPeucker(const float* x, const float* y, const int count, const float tolerance, bool* keep, int32_t (*stack)[2])
+{
+  for (int i=0; i < count; i++)
+    keep[i] = (i == 0 || i == count-1);
+
+  int top = 0;
+  if (count > 2)
+  {
+    stack[top][0] = 0;
+    stack[top][1] = count-1;
+    top++;
+  }
+
+  while (top > 0)
+  {
+    top--;
+    const int a = stack[top][0];
+    const int b = stack[top][1];
+
+    int worst = -1;
+    float worstDistance = tolerance;
+    for (int i=a+1; i < b; i++)
+    {
+      const float d = distanceToSegment(x[i], y[i], x[a], y[a], x[b], y[b]);
+      if (d > worstDistance)
+      {
+        worstDistance = d;
+        worst = i;
+      }
+    }
+
+    if (worst < 0)
+      continue;
+
+    keep[worst] = true;
+    if (worst - a > 1)  { stack[top][0] = a;      stack[top][1] = worst;  top++; }
+    if (b - worst > 1)  { stack[top][0] = worst;  stack[top][1] = b;      top++; }
+  }
+
+  int kept = 0;
+  for (int i=0; i < count; i++)
+    kept += keep[i];
+  return kept;
+}
+
+#endif
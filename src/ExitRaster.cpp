@@ -0,0 +1,198 @@
+#include "ExitRaster.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+#include "NavigationWaypoints.h"
+#include "PsramAlloc.h"
+
+#include <LittleFS.h>
+#include <FS.h>
+
+static const uint32_t s_exitRasterMagic = 0x52584558;   // "EXXR"
+static const uint16_t s_exitRasterVersion = 2;
+
+// extend beyond the outermost waypoints so divers off the edge of the features still hit the raster
+static const float s_marginMetres = 100.0f;
+static const uint32_t s_maxCells = 1024u * 1024u;
+
+static const uint8_t s_noExit = 0xFF;
+
+ExitRaster::ExitRaster() : _cols(0), _rows(0), _cells(nullptr)
+{
+  memset(&_header, 0, sizeof(_header));
+}
+
+ExitRaster::~ExitRaster()
+{
+  clear();
+}
+
+void ExitRaster::clear()
+{
+  if (_cells)
+    psramFree(_cells);
+
+  _cells = nullptr;
+  _cols = _rows = 0;
+}
+
+bool ExitRaster::initGeometry(const SiteFrame& frame, const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex,
+                              const int* exitIndices, const int exitCount, const float cellSizeMetres)
+{
+  if (exitCount <= 0 || exitCount > s_maxExits || endIndex <= firstIndex || !frame.isSet())
+    return false;
+
+  memset(&_header, 0, sizeof(_header));   // header is compared bytewise against the file, padding included
+  _header.magic = s_exitRasterMagic;
+  _header.version = s_exitRasterVersion;
+  _header.exitCount = exitCount;
+  for (int i=0; i < exitCount; i++)
+  {
+    _header.exitIndices[i] = exitIndices[i];
+    _header.exitLat[i] = waypoints[exitIndices[i]]._lat;
+    _header.exitLong[i] = waypoints[exitIndices[i]]._long;
+  }
+
+  double minLat = 90, maxLat = -90, minLong = 180, maxLong = -180;
+  for (int i=firstIndex; i < endIndex; i++)
+  {
+    minLat = std::min(minLat, waypoints[i]._lat);   maxLat = std::max(maxLat, waypoints[i]._lat);
+    minLong = std::min(minLong, waypoints[i]._long); maxLong = std::max(maxLong, waypoints[i]._long);
+  }
+
+  _header.metresPerDegreeLat = frame.metresPerDegreeLat();
+  _header.metresPerDegreeLong = frame.metresPerDegreeLong();
+
+  _header.minLat = minLat - s_marginMetres / _header.metresPerDegreeLat;
+  _header.minLong = minLong - s_marginMetres / _header.metresPerDegreeLong;
+
+  const float width = (maxLong - minLong) * _header.metresPerDegreeLong + 2 * s_marginMetres;
+  const float height = (maxLat - minLat) * _header.metresPerDegreeLat + 2 * s_marginMetres;
+
+  _header.cellSize = cellSizeMetres;
+  while ((uint32_t)(width / _header.cellSize + 1) * (uint32_t)(height / _header.cellSize + 1) > s_maxCells)
+    _header.cellSize *= 2.0f;
+
+  _header.cols = (uint16_t)(width / _header.cellSize) + 1;
+  _header.rows = (uint16_t)(height / _header.cellSize) + 1;
+
+  return true;
+}
+
+bool ExitRaster::allocate()
+{
+  clear();
+
+  _cells = (uint8_t*)psramMalloc((size_t)_header.cols * _header.rows);
+  if (_cells == nullptr)
+    return false;
+
+  _cols = _header.cols;
+  _rows = _header.rows;
+  return true;
+}
+
+bool ExitRaster::build(const SiteFrame& frame, const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex,
+                       const int* exitIndices, const int exitCount, const float cellSizeMetres)
+{
+  if (!initGeometry(frame, waypoints, firstIndex, endIndex, exitIndices, exitCount, cellSizeMetres) || !allocate())
+    return false;
+
+  // exits in raster-local metres
+  float exitE[s_maxExits], exitN[s_maxExits];
+  for (int i=0; i < exitCount; i++)
+  {
+    exitE[i] = (_header.exitLong[i] - _header.minLong) * _header.metresPerDegreeLong;
+    exitN[i] = (_header.exitLat[i] - _header.minLat) * _header.metresPerDegreeLat;
+  }
+
+  for (int y=0; y < _rows; y++)
+  {
+    const float n = (y + 0.5f) * _header.cellSize;
+    uint8_t* row = _cells + (size_t)y * _cols;
+
+    for (int x=0; x < _cols; x++)
+    {
+      const float e = (x + 0.5f) * _header.cellSize;
+
+      // strict < keeps the lowest slot on ties, matching the linear search
+      uint8_t best = s_noExit;
+      float bestD2 = 1e30f;
+      for (int i=0; i < exitCount; i++)
+      {
+        const float de = exitE[i] - e;
+        const float dn = exitN[i] - n;
+        const float d2 = de*de + dn*dn;
+        if (d2 < bestD2) { bestD2 = d2; best = i; }
+      }
+      row[x] = best;
+    }
+  }
+
+  return true;
+}
+
+int ExitRaster::lookup(const double lat, const double lng) const
+{
+  if (_cells == nullptr)
+    return -1;
+
+  const int x = (int)floor((lng - _header.minLong) * _header.metresPerDegreeLong / _header.cellSize);
+  const int y = (int)floor((lat - _header.minLat) * _header.metresPerDegreeLat / _header.cellSize);
+
+  if (x < 0 || x >= _cols || y < 0 || y >= _rows)
+    return -1;
+
+  const uint8_t slot = _cells[(size_t)y * _cols + x];
+  return (slot == s_noExit ? -1 : _header.exitIndices[slot]);
+}
+
+bool ExitRaster::save(const char* filename) const
+{
+  if (_cells == nullptr)
+    return false;
+
+  fs::File f = LittleFS.open(filename, FILE_WRITE);
+  if (!f)
+    return false;
+
+  const size_t cellBytes = (size_t)_cols * _rows;
+  bool ok = (f.write((const uint8_t*)&_header, sizeof(_header)) == sizeof(_header));
+  ok = ok && (f.write(_cells, cellBytes) == cellBytes);
+  f.close();
+
+  if (!ok)
+    LittleFS.remove(filename);
+
+  return ok;
+}
+
+bool ExitRaster::load(const char* filename, const SiteFrame& frame, const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex,
+                      const int* exitIndices, const int exitCount, const float cellSizeMetres)
+{
+  if (!LittleFS.exists(filename) || !initGeometry(frame, waypoints, firstIndex, endIndex, exitIndices, exitCount, cellSizeMetres))
+    return false;
+
+  fs::File f = LittleFS.open(filename, FILE_READ);
+  if (!f)
+    return false;
+
+  // the stored raster is only valid for the same exits, where they are now, and the geometry we would build now
+  Header stored;
+  if (f.read((uint8_t*)&stored, sizeof(stored)) != sizeof(stored) || memcmp(&stored, &_header, sizeof(stored)) != 0 || !allocate())
+  {
+    f.close();
+    return false;
+  }
+
+  const size_t cellBytes = (size_t)_cols * _rows;
+  const bool ok = (f.read(_cells, cellBytes) == cellBytes);
+  f.close();
+
+  if (!ok)
+    clear();
+
+  return ok;
+}
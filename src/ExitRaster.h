@@ -0,0 +1,71 @@
+#ifndef ExitRaster_h
+#define ExitRaster_h
+
+#include <stdint.h>
+
+#include "SiteFrame.h"
+
+class NavigationWaypoint;
+
+/* Nearest-exit lookup raster for one site.
+ *
+ * Each cell (default 2m square) over the site's waypoint extent holds the slot
+ * of the exit nearest to the cell centre, so a frame-time lookup is one array
+ * read. Exits are fixed per site, so the raster is built once - in PSRAM where
+ * available - and can be saved to / loaded from LittleFS to skip the build on
+ * the next boot. Positions outside the raster return -1 and callers fall back
+ * to a search.
+ */
+class ExitRaster
+{
+  public:
+    static const int s_maxExits = 10;
+
+    ExitRaster();
+    ~ExitRaster();
+
+    bool build(const SiteFrame& frame, const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex,
+               const int* exitIndices, const int exitCount, const float cellSizeMetres = 2.0f);
+
+    bool save(const char* filename) const;
+    bool load(const char* filename, const SiteFrame& frame, const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex,
+              const int* exitIndices, const int exitCount, const float cellSizeMetres = 2.0f);
+
+    void clear();
+
+    bool isBuilt() const { return _cells != nullptr; }
+
+    // waypoint index of the nearest exit, or -1 if lat/lng is outside the raster
+    int lookup(const double lat, const double lng) const;
+
+    uint32_t sizeBytes() const { return (uint32_t)_cols * _rows; }
+
+  private:
+    struct Header
+    {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t exitCount;
+      int16_t exitIndices[s_maxExits];
+      double exitLat[s_maxExits];       // so a raster saved before an exit was moved isn't loaded for it
+      double exitLong[s_maxExits];
+      float cellSize;
+      double minLat;
+      double minLong;
+      double metresPerDegreeLat;
+      double metresPerDegreeLong;
+      uint16_t cols;
+      uint16_t rows;
+    };
+
+    bool initGeometry(const SiteFrame& frame, const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex,
+                      const int* exitIndices, const int exitCount, const float cellSizeMetres);
+    bool allocate();
+
+    Header _header;
+    uint16_t _cols;
+    uint16_t _rows;
+    uint8_t* _cells;    // slot into _header.exitIndices, 0xFF for none
+};
+
+#endif
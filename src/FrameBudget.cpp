@@ -0,0 +1,70 @@
+#include "FrameBudget.h"
+
+FrameBudget::FrameBudget() : _budgetUs(0), _startUs(0), _lastFrameUs(0), _frames(0), _misses(0)
+{
+  for (int l=0; l < s_maxLayers; l++)
+  {
+    _priority[l] = e_high;
+    _cost[l] = 0;
+    _owed[l] = false;
+    _deferred[l] = 0;
+    _skipped[l] = 0;
+  }
+}
+
+void FrameBudget::beginFrame(const uint32_t budgetUs, const uint32_t nowUs)
+{
+  _budgetUs = budgetUs;
+  _startUs = nowUs;
+}
+
+FrameBudget::decisions FrameBudget::decide(const int layer, const uint32_t nowUs, const bool canDefer)
+{
+  // a layer put off last frame draws whatever is left, so it can't be starved
+  if (_budgetUs == 0 || _owed[layer] || _priority[layer] == e_essential)
+    return e_draw;
+
+  const uint32_t used = nowUs - _startUs;
+  const uint32_t left = (used < _budgetUs ? _budgetUs - used : 0);
+  const bool fits = (_priority[layer] == e_high ? left > 0 : _cost[layer] <= left);
+  if (fits)
+    return e_draw;
+
+  _owed[layer] = true;
+  if (canDefer)
+  {
+    _deferred[layer]++;
+    return e_defer;
+  }
+
+  _skipped[layer]++;
+  return e_skip;
+}
+
+bool FrameBudget::isAnyOwed() const
+{
+  for (int l=0; l < s_maxLayers; l++)
+  {
+    if (_owed[l])
+      return true;
+  }
+  return false;
+}
+
+void FrameBudget::layerDrawn(const int layer, const uint32_t costUs)
+{
+  // a moving average, so one slow frame - a map switch, a cache miss - doesn't starve the layer for long
+  _cost[layer] = (_cost[layer] == 0 ? costUs : (_cost[layer] * 3 + costUs) / 4);
+  _owed[layer] = false;
+}
+
+bool FrameBudget::endFrame(const uint32_t nowUs)
+{
+  _lastFrameUs = nowUs - _startUs;
+  _frames++;
+
+  const bool missed = (_budgetUs > 0 && _lastFrameUs > _budgetUs);
+  if (missed)
+    _misses++;
+  return missed;
+}
@@ -0,0 +1,65 @@
+#ifndef FrameBudget_h
+#define FrameBudget_h
+
+#include <stdint.h>
+
+/* A time budget per frame for the optional layers drawn over the base map.
+ *
+ * Each layer's cost is learnt from micros() as it's drawn. Before a layer,
+ * decide() weighs what's left of the budget: essential layers always draw,
+ * high priority ones draw until the frame is over budget, and low priority
+ * ones only if their usual cost still fits. A layer that is put off - drawn by
+ * its cheaper deferred path where it has one, else skipped - is owed, and
+ * drawn as essential the next frame, so it lags by a frame at most. A frame
+ * that ends over budget counts as a miss.
+ */
+class FrameBudget
+{
+  public:
+    enum priorities { e_essential, e_high, e_low };
+    enum decisions { e_draw, e_defer, e_skip };
+
+    static const int s_maxLayers = 8;
+
+    FrameBudget();
+
+    void setPriority(const int layer, const priorities priority)  { _priority[layer] = priority; }
+    priorities getPriority(const int layer) const                 { return _priority[layer]; }
+
+    // 0 for no budget, when every layer draws
+    void beginFrame(const uint32_t budgetUs, const uint32_t nowUs);
+    decisions decide(const int layer, const uint32_t nowUs, const bool canDefer);
+
+    // the cost of a full draw, learnt for the next decide(); a deferred draw leaves the layer owed
+    void layerDrawn(const int layer, const uint32_t costUs);
+
+    // shown without drawing, from a cached base, so no longer owed; the learnt cost is kept
+    void layerCached(const int layer)           { _owed[layer] = false; }
+
+    // true if the frame went over budget
+    bool endFrame(const uint32_t nowUs);
+
+    bool isOwed(const int layer) const          { return _owed[layer]; }
+    bool isAnyOwed() const;
+    uint32_t expectedCost(const int layer) const { return _cost[layer]; }
+    uint32_t deferred(const int layer) const    { return _deferred[layer]; }
+    uint32_t skipped(const int layer) const     { return _skipped[layer]; }
+    uint32_t frames() const                     { return _frames; }
+    uint32_t misses() const                     { return _misses; }
+    uint32_t lastFrameUs() const                { return _lastFrameUs; }
+
+  private:
+    priorities _priority[s_maxLayers];
+    uint32_t _cost[s_maxLayers];
+    bool _owed[s_maxLayers];
+    uint32_t _deferred[s_maxLayers];
+    uint32_t _skipped[s_maxLayers];
+
+    uint32_t _budgetUs;
+    uint32_t _startUs;
+    uint32_t _lastFrameUs;
+    uint32_t _frames;
+    uint32_t _misses;
+};
+
+#endif
@@ -0,0 +1,68 @@
+#include "MapExtentIndex.h"
+
+#include <math.h>
+
+void MapExtentIndex::add(const int mapIndex, const bool detail, const float lngLeft, const float lngRight, const float latBottom,
+                         const int16_t width, const int16_t height)
+{
+  // as convertGeoToFractionalPixel: y = height - (mercator(lat) - mercator(bottom)), so the top row is height above the bottom
+  const double lngDelta = (double)lngRight - lngLeft;
+  const double worldMapWidth = ((width / lngDelta) * 360.0) / (2.0 * M_PI);
+  const double bottomRad = latBottom * M_PI / 180.0;
+  const double bottomMercator = worldMapWidth / 2.0 * log((1.0 + sin(bottomRad)) / (1.0 - sin(bottomRad)));
+  const double northRad = asin(tanh((bottomMercator + height) / worldMapWidth));
+
+  Entry e;
+  e.mapIndex = mapIndex;
+  e.detail = detail;
+  e.extent.west = lngLeft;
+  e.extent.east = lngRight;
+  e.extent.south = latBottom;
+  e.extent.north = northRad * 180.0 / M_PI;
+  _entries.push_back(e);
+}
+
+int MapExtentIndex::firstContaining(const double lat, const double lng) const
+{
+  int first = -1;
+  for (const Entry& e : _entries)
+  {
+    if (e.detail && e.extent.contains(lat, lng) && (first < 0 || e.mapIndex < first))
+      first = e.mapIndex;
+  }
+  return first;
+}
+
+const MapExtentIndex::Entry* MapExtentIndex::entry(const int mapIndex) const
+{
+  for (const Entry& e : _entries)
+  {
+    if (e.mapIndex == mapIndex)
+      return &e;
+  }
+  return nullptr;
+}
+
+const MapExtentIndex::Extent* MapExtentIndex::extent(const int mapIndex) const
+{
+  const Entry* e = entry(mapIndex);
+  return e ? &e->extent : nullptr;
+}
+
+bool MapExtentIndex::holdsSwitchFrom(const int mapIndex, const double lat, const double lng, const SiteFrame& frame, const float marginMetres,
+                                     float& metresBeyond) const
+{
+  metresBeyond = 0;
+  const Entry* e = entry(mapIndex);
+  if (e == nullptr || !e->detail || !frame.isSet())
+    return false;
+
+  metresBeyond = e->extent.metresOutside(lat, lng, frame.metresPerDegreeLat(), frame.metresPerDegreeLong());
+  return marginMetres > 0 && metresBeyond < marginMetres;
+}
+
+bool MapExtentIndex::contains(const int mapIndex, const double lat, const double lng) const
+{
+  const Extent* x = extent(mapIndex);
+  return x != nullptr && x->contains(lat, lng);
+}
@@ -0,0 +1,78 @@
+#ifndef MapExtentIndex_h
+#define MapExtentIndex_h
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+#include "SiteFrame.h"
+
+/* Geographic bounding box of each map image, so the maps under the diver are
+ * found by comparing latitude and longitude rather than projecting the diver
+ * into every map in turn.
+ *
+ * A map is given by its left and right longitudes and bottom latitude; the top
+ * latitude is where the map's Mercator projection reaches the top row, worked
+ * out once when the map is added. Boxes are half-open like the pixel test they
+ * replace: west and north edges in, east and south edges out.
+ */
+class MapExtentIndex
+{
+  public:
+    class Extent
+    {
+      public:
+        double west;
+        double east;
+        double south;
+        double north;
+
+        bool contains(const double lat, const double lng) const
+        {
+          return lng >= west && lng < east && lat > south && lat <= north;
+        }
+
+        // straight line distance to the nearest point of the box, 0 inside it
+        float metresOutside(const double lat, const double lng, const double metresPerDegreeLat, const double metresPerDegreeLong) const
+        {
+          const double n = (lat < south ? south - lat : lat > north ? lat - north : 0) * metresPerDegreeLat;
+          const double e = (lng < west ? west - lng : lng > east ? lng - east : 0) * metresPerDegreeLong;
+          return (float)hypot(e, n);
+        }
+    };
+
+    void clear()                  { _entries.clear(); }
+    bool isEmpty() const          { return _entries.empty(); }
+
+    // detail maps are the ones firstContaining() picks from
+    void add(const int mapIndex, const bool detail, const float lngLeft, const float lngRight, const float latBottom,
+             const int16_t width, const int16_t height);
+
+    // lowest indexed detail map containing lat/lng, or -1
+    int firstContaining(const double lat, const double lng) const;
+
+    // false too for a map not in the index
+    bool contains(const int mapIndex, const double lat, const double lng) const;
+    const Extent* extent(const int mapIndex) const;
+
+    // true while a switch away from mapIndex should wait, lat/lng being under marginMetres past its edge, metresBeyond
+    // being how far. Only a detail map holds one: the all lake map always has the diver on it, and a map not in the
+    // index or a site frame not yet set has no edge to measure from, so those switch at once
+    bool holdsSwitchFrom(const int mapIndex, const double lat, const double lng, const SiteFrame& frame, const float marginMetres,
+                         float& metresBeyond) const;
+
+  private:
+    class Entry
+    {
+      public:
+        int mapIndex;
+        bool detail;
+        Extent extent;
+    };
+
+    std::vector<Entry> _entries;
+
+    const Entry* entry(const int mapIndex) const;
+};
+
+#endif
@@ -7,7 +7,9 @@
 #include <algorithm>
 
 #include "NavigationWaypoints.h"
-#include "Traces.h"
+#include "TraceLod.h"
+#include "DouglasPeucker.h"
+#include "SlicedTask.h"
 
 #include "TinyGPS++.h"
 
@@ -22,12 +24,40 @@ PNG png;
 // PNG callback functions for LittleFS - based on PNGDisplay.inl implementation
 static fs::File pngFile;
 static TFT_eSprite* pngTargetSprite = nullptr;
-static std::vector<uint16_t> pngPixelBuffer;  // Static buffer for PNG decoding (screen-sized, reused for each decode)
-static std::string lastLoadedPngFilename;      // Tracks which PNG is currently decoded in pngPixelBuffer
 
-// Pre-computed trace pixel cache — geo->pixel is expensive (float math), so bake once per map change
-static std::vector<MapScreen_ex::pixel> tracePixelCache;
-static const MapScreen_ex::geo_map* tracePixelCacheMap = nullptr;
+// Screen-sized PNG decode buffers, each remembering the PNG decoded in it. The second is only allocated with the
+// composed tile cache, so the all-lake map pre-decoded during idle doesn't evict the detail map's decode, or with
+// pngSliceMicros, so a sliced decode fills the buffer not on screen.
+static std::vector<uint16_t> pngPixelBuffers[2];
+static std::string pngBufferFilenames[2];
+static int pngLastUsedBuffer = 0;
+static std::vector<uint16_t>* pngDecodeTarget = &pngPixelBuffers[0];   // the buffer pngDrawToSprite writes
+static int pngDecodedRows = 0;
+
+// a map switch's decode run a slice a frame into the buffer not on screen, the old map staying up until it's whole
+static SlicedTask pngSlicedDecode;
+static int pngSlicedBuffer = 0;
+static std::string pngSlicedFilename;
+static int pngSlicedResult = PNG_SUCCESS;
+
+static bool isPngDecoded(const char* filename)
+{
+  return filename && (pngBufferFilenames[0] == filename || pngBufferFilenames[1] == filename);
+}
+
+// marks the buffer used, so the next decode goes in the other one
+static const uint16_t* decodedPngPixels(const char* filename)
+{
+  for (int b = 0; b < 2; b++)
+  {
+    if (filename && !pngPixelBuffers[b].empty() && pngBufferFilenames[b] == filename)
+    {
+      pngLastUsedBuffer = b;
+      return pngPixelBuffers[b].data();
+    }
+  }
+  return nullptr;
+}
 
 static void * pngOpenLFS(const char *filename, int32_t *size) {
   pngFile = LittleFS.open(filename, FILE_READ);
@@ -54,6 +84,7 @@ static int32_t pngSeek(PNGFILE *handle, int32_t position) {
 }
 
 static int pngDrawToSprite(PNGDRAW *pDraw) {
+  std::vector<uint16_t>& pngPixelBuffer = *pngDecodeTarget;
   if (pngPixelBuffer.empty()) return 0;
   
   uint16_t usPixels[pDraw->iWidth];
@@ -64,10 +95,84 @@ static int pngDrawToSprite(PNGDRAW *pDraw) {
   if (offset + pDraw->iWidth <= pngPixelBuffer.size()) {
     memcpy(&pngPixelBuffer[offset], usPixels, pDraw->iWidth * sizeof(uint16_t));
   }
+  pngDecodedRows = pDraw->y + 1;
+
+  if (pngSlicedDecode.isRunning())
+    pngSlicedDecode.step();
   
   return 1;
 }
 
+static void pngSlicedDecodeJob(void* context)
+{
+  pngSlicedResult = png.decode(NULL, 0);
+  png.close();
+}
+
+// false if it couldn't start, when drawPNG decodes the PNG whole as before
+static bool startSlicedPngDecode(const char* filename, const uint32_t stackBytes)
+{
+  const int b = 1 - pngLastUsedBuffer;
+  if (pngPixelBuffers[b].empty() || !LittleFS.exists(filename))
+    return false;
+
+  if (png.open(filename, pngOpenLFS, pngClose, pngRead, pngSeek, pngDrawToSprite) != PNG_SUCCESS)
+    return false;
+
+  pngDecodeTarget = &pngPixelBuffers[b];
+  pngBufferFilenames[b].clear();
+  pngDecodedRows = 0;
+  pngSlicedBuffer = b;
+  pngSlicedFilename = filename;
+  pngSlicedResult = PNG_SUCCESS;
+
+  if (!pngSlicedDecode.start(pngSlicedDecodeJob, nullptr, "pngSlice", stackBytes))
+  {
+    png.close();
+    return false;
+  }
+
+  USB_SERIAL.printf("PNG SLICED: decoding %s into buffer %d\n", filename, b);
+  return true;
+}
+
+// true once no sliced decode is left running, the buffer then holding its PNG or the error colour
+static bool continueSlicedPngDecode(const uint32_t sliceMicros, const uint32_t sliceRows)
+{
+  if (!pngSlicedDecode.isRunning())
+    return true;
+
+  if (!pngSlicedDecode.resume(sliceMicros, sliceRows))
+    return false;
+
+  std::vector<uint16_t>& pngPixelBuffer = pngPixelBuffers[pngSlicedBuffer];
+  pngLastUsedBuffer = pngSlicedBuffer;     // about to go on screen
+  if (pngSlicedResult == PNG_SUCCESS)
+  {
+    pngBufferFilenames[pngSlicedBuffer] = pngSlicedFilename;
+  }
+  else
+  {
+    USB_SERIAL.printf("png.decode() failed: %d\n", pngSlicedResult);
+    std::fill(pngPixelBuffer.begin(), pngPixelBuffer.end(), PINK);  // Pink on decode error
+  }
+
+  USB_SERIAL.printf("PNG SLICED: %s done in %lu slices, longest %luus\n", pngSlicedFilename.c_str(),
+                    pngSlicedDecode.slices(), pngSlicedDecode.longestSliceMicros());
+  return true;
+}
+
+static bool isPngDecodingSliced(const char* filename)
+{
+  return filename && pngSlicedDecode.isRunning() && pngSlicedFilename == filename;
+}
+
+// before anything else uses the decoder
+static void finishSlicedPngDecode()
+{
+  while (!continueSlicedPngDecode(0, 0)) {}
+}
+
 
 MapScreen_ex::MapScreen_ex(TFT_eSPI& tft, const MapScreenAttr mapAttributes) : 
                                                         _zoom(1),
@@ -86,10 +191,10 @@ MapScreen_ex::MapScreen_ex(TFT_eSPI& tft, const MapScreenAttr mapAttributes) :
                                                         _tft(tft),
                                                         _mapAttr(mapAttributes),
                                                         _exitWaypointCount(0),
-                                                        _nextCrumbIndex(0),
                                                         _showBreadCrumbTrail(true),
                                                         _recordBreadCrumbTrail(false),
                                                         _recordActionCallback(nullptr),
+                                                        _nearestFeatureTracker(_featureGrid, TinyGPSPlus::distanceBetweenAccurate),
                                                         LOG_HOOK(&Serial)
 {
   _debugString[0] = '\0';
@@ -109,6 +214,15 @@ MapScreen_ex::MapScreen_ex(TFT_eSPI& tft, const MapScreenAttr mapAttributes) :
   _rotatedBreadCrumbSprite = std::make_unique<TFT_eSprite>(&_tft);
 
   _pinSprite = std::make_unique<TFT_eSprite>(&_tft);
+  _prerenderSprite = std::make_unique<TFT_eSprite>(&_tft);
+  _headingUpSprite = std::make_unique<TFT_eSprite>(&_tft);
+
+  // the exit and target lines are for safety, so are never put off
+  _frameBudget.setPriority(e_traces_layer, FrameBudget::e_low);
+  _frameBudget.setPriority(e_crumbs_layer, FrameBudget::e_low);
+  _frameBudget.setPriority(e_pins_layer, FrameBudget::e_high);
+  _frameBudget.setPriority(e_lines_layer, FrameBudget::e_essential);
+  _frameBudget.setPriority(e_title_layer, FrameBudget::e_high);
 }
 
 void MapScreen_ex::initMapScreen()
@@ -116,7 +230,205 @@ void MapScreen_ex::initMapScreen()
   initMaps();
   initSprites();
   initExitWaypoints();
+  initWaypointSpatialIndex();
   initFeatureColours();
+  initBreadCrumbStorage();
+  initTraceLayers();
+}
+
+void MapScreen_ex::initTraceLayers()
+{
+  // colours after the first, which is traceColour
+  static const uint16_t layerColours[] = { TFT_CYAN, TFT_MAGENTA, TFT_ORANGE, TFT_GREENYELLOW, TFT_PINK, TFT_GOLD, TFT_SKYBLUE };
+
+  _traceLayers.clear();
+  _traceLayers.reserve(s_maxTraceLayers);
+
+  fs::File dir = LittleFS.open("/traces");
+  if (dir && dir.isDirectory())
+  {
+    for (fs::File f = dir.openNextFile(); f && _traceLayers.size() < s_maxTraceLayers; f = dir.openNextFile())
+    {
+      // arduino-esp32 v1 gives the full path, v2 the base name
+      const char* base = strrchr(f.name(), '/');
+      const std::string filename = std::string("/traces/") + (base ? base + 1 : f.name());
+      f.close();
+
+      const size_t length = filename.size();
+      if (length < 4 || filename.compare(length - 4, 4, ".trc") != 0)
+        continue;
+
+      const uint16_t colour = (_traceLayers.empty() ? _mapAttr.traceColour : layerColours[(_traceLayers.size() - 1) % (sizeof(layerColours) / sizeof(layerColours[0]))]);
+      addTraceLayer(filename.c_str(), colour);
+    }
+    dir.close();
+  }
+
+  if (_traceLayers.empty())
+  {
+    _traceLayers.push_back(TraceLayer());
+    _traceLayers.back().setBuiltIn("survey", _mapAttr.traceColour);
+  }
+
+  for (size_t i=0; i < _traceLayers.size(); i++)
+    USB_SERIAL.printf("trace layer %d '%s' %d points\n", (int)i, _traceLayers[i].name(), _traceLayers[i].pointCount());
+}
+
+int MapScreen_ex::addTraceLayer(const char* filename, const uint16_t colour, const bool visible)
+{
+  if (_traceLayers.size() >= s_maxTraceLayers)
+    return -1;
+
+  TraceLayer layer;
+  if (!layer.setFile(filename, colour))
+  {
+    USB_SERIAL.printf("addTraceLayer: '%s' missing or malformed\n", filename);
+    return -1;
+  }
+
+  layer.visible = visible;
+  _traceLayers.push_back(layer);
+  invalidateOverlay(e_trace_overlay);
+  return _traceLayers.size() - 1;
+}
+
+void MapScreen_ex::initBreadCrumbStorage()
+{
+  const int maxCrumbs = (_mapAttr.maxBreadCrumbs > 0 ? _mapAttr.maxBreadCrumbs : _defaultMaxBreadCrumbs);
+  const int maxPins = (_mapAttr.maxPlacedPins > 0 ? _mapAttr.maxPlacedPins : _defaultMaxPlacedPins);
+
+  // the log is budgeted in bytes: at the default 32 a crumb, the RAM the fixed trail took, 7.5-10x the crumbs fit at full resolution
+  const int bytesPerCrumb = (_mapAttr.breadCrumbBudgetBytesPerCrumb > 0 ? _mapAttr.breadCrumbBudgetBytesPerCrumb : _defaultBreadCrumbBudgetBytesPerCrumb);
+  bool created = _breadCrumbTrail.allocate(maxCrumbs * bytesPerCrumb);
+  _breadCrumbTrail.setThinning(_breadCrumbThinningToleranceMetres, _breadCrumbFullResolutionCount);
+  USB_SERIAL.printf("_breadCrumbTrail %lu bytes (%d crumbs at %d bytes) %s\n", _breadCrumbTrail.budgetBytes(), maxCrumbs, bytesPerCrumb, (created ? "created" : "FAILED creation"));
+
+  created = _placedPins.allocate(maxPins);
+  _placedPinTimesMs.clear();
+  _placedPinTimesMs.reserve(maxPins);
+  USB_SERIAL.printf("_placedPins %d pins (%lu bytes) %s\n", maxPins, _placedPins.sizeBytes(), (created ? "created" : "FAILED creation"));
+
+  recoverBreadCrumbJournals();
+}
+
+void MapScreen_ex::recoverBreadCrumbJournals()
+{
+  _breadCrumbJournal.begin("/breadcrumbs.jnl", "/breadcrumbs.prev.jnl");
+  _pinJournal.begin("/pins.jnl", "/pins.prev.jnl");
+
+  uint32_t tStart = micros();
+  const int crumbs = _breadCrumbJournal.recover([this](const CrumbLog::Crumb& crumb)
+  {
+    if (!_breadCrumbTrail.append(crumb))
+    {
+      // replay outruns the per-frame thinning, so finish a pass here and retry
+      while (_breadCrumbTrail.thinStep(_siteFrame) && _breadCrumbTrail.isThinning())
+        ;
+      _breadCrumbTrail.append(crumb);
+    }
+    _breadCrumbTrail.thinStep(_siteFrame);
+    _lastBreadCrumbLocal = _siteFrame.toLocal(crumb.lat(), crumb.lng());
+  });
+  USB_SERIAL.printf("recoverBreadCrumbJournals: replayed %d crumbs (%d kept) from %lu bytes in %luus\n",
+                    crumbs, _breadCrumbTrail.size(), _breadCrumbJournal.journalBytes(), micros()-tStart);
+
+  tStart = micros();
+  int pinsDropped = 0;
+  const int pins = _pinJournal.recover([this, &pinsDropped](const CrumbLog::Crumb& pin)
+  {
+    if (_placedPins.push(pin.lat(), pin.lng(), pin.headingDegrees(), pin.depthMetres(), pin.timeMs))
+      _placedPinTimesMs.push_back(pin.timeMs);
+    else
+      pinsDropped++;
+  });
+  USB_SERIAL.printf("recoverBreadCrumbJournals: replayed %d pins in %luus\n", pins, micros()-tStart);
+
+  // a journal from a build with more pins, or from before pins could be cleared - keep only what is shown
+  if (pinsDropped > 0)
+  {
+    USB_SERIAL.printf("recoverBreadCrumbJournals: pin store full, dropped %d pins\n", pinsDropped);
+    compactPinJournal();
+  }
+}
+
+bool MapScreen_ex::compactBreadCrumbJournal()
+{
+  const uint32_t tStart = micros();
+  CrumbLog::Iterator it = _breadCrumbTrail.begin();
+  const bool compacted = _breadCrumbJournal.compact([&it](CrumbLog::Crumb& crumb) { return it.next(crumb); });
+  USB_SERIAL.printf("compactBreadCrumbJournal: %s, %lu bytes in %luus\n", (compacted ? "done" : "FAILED"), _breadCrumbJournal.journalBytes(), micros()-tStart);
+  return compacted;
+}
+
+bool MapScreen_ex::compactPinJournal()
+{
+  const uint32_t tStart = micros();
+  int i = 0;
+  const bool compacted = _pinJournal.compact([this, &i](CrumbLog::Crumb& pin)
+  {
+    if (i >= _placedPins.size())
+      return false;
+
+    double lat, lng, heading, depth;
+    _placedPins.get(i, lat, lng, heading, depth);
+    pin = CrumbLog::Crumb::fromDegrees(lat, lng, heading, depth, _placedPinTimesMs[i]);
+    i++;
+    return true;
+  });
+  USB_SERIAL.printf("compactPinJournal: %s, %lu bytes in %luus\n", (compacted ? "done" : "FAILED"), _pinJournal.journalBytes(), micros()-tStart);
+  return compacted;
+}
+
+void MapScreen_ex::serviceIdle()
+{
+  const uint32_t tStart = micros();
+  const uint32_t now = millis();
+
+  // the thinned trail is always smaller than the journal of every crumb dropped
+  if (_breadCrumbJournal.isFull())
+    compactBreadCrumbJournal();
+
+  const bool wroteCrumbs = _breadCrumbJournal.service(now);
+  const bool wrotePins = (_pinJournal.pendingRecords() > 0 && _pinJournal.flush());   // pins are rare and deliberate, so don't batch them
+
+  if (wroteCrumbs || wrotePins)
+    USB_SERIAL.printf("serviceIdle: journal write %luus (%lu crumbs, %lu pins written, %lu dropped)\n", micros()-tStart,
+                      _breadCrumbJournal.recordsWritten(), _pinJournal.recordsWritten(),
+                      _breadCrumbJournal.recordsDropped() + _pinJournal.recordsDropped());
+
+  // so the next zoom button press finds its tile already composed
+  prerenderZoomCycle();
+}
+
+MapScreen_ex::BreadCrumb MapScreen_ex::unpackCrumb(const CrumbPool& pool, const int i) const
+{
+  BreadCrumb crumb;
+  pool.get(i, crumb._lat, crumb._long, crumb._heading, crumb._depth);
+  crumb._local = _siteFrame.toLocal(crumb._lat, crumb._long);
+  return crumb;
+}
+
+MapScreen_ex::BreadCrumb MapScreen_ex::unpackCrumb(const CrumbLog::Crumb& c) const
+{
+  BreadCrumb crumb;
+  crumb._lat = c.lat();
+  crumb._long = c.lng();
+  crumb._heading = c.headingDegrees();
+  crumb._depth = c.depthMetres();
+  crumb._local = _siteFrame.toLocal(crumb._lat, crumb._long);
+  return crumb;
+}
+
+MapScreen_ex::BreadCrumb MapScreen_ex::getBreadCrumb(const int i) const
+{
+  CrumbLog::Crumb c;
+  _breadCrumbTrail.get(i, c);
+  return unpackCrumb(c);
+}
+
+MapScreen_ex::BreadCrumb MapScreen_ex::getPlacedPin(const int i) const
+{
+  return unpackCrumb(_placedPins, i);
 }
 
 void MapScreen_ex::initFeatureColours()
@@ -141,6 +453,7 @@ void MapScreen_ex::initFirstAndEndWaypointsIndices()
 
 void MapScreen_ex::displayMapLegend()
 {
+    redrawNextFrame();
     int backColour = TFT_BLACK;
 
     _compositedScreenSprite->fillSprite(backColour);
@@ -184,7 +497,27 @@ void MapScreen_ex::initSprites()
     _baseMapCacheSprite->createSprite(getTFTWidth(),getTFTHeight());
 
     // Allocate PNG pixel buffer only when base cache is enabled (screen-sized, reused for each PNG decode)
-    pngPixelBuffer.resize(getTFTWidth() * getTFTHeight());
+    pngPixelBuffers[0].resize(getTFTWidth() * getTFTHeight());
+
+    const size_t tileBytes = (size_t)getTFTWidth() * getTFTHeight() * sizeof(uint16_t);
+    const size_t cacheBytes = (_mapAttr.composedTileCacheBytes > 0 ? _mapAttr.composedTileCacheBytes :
+                               _mapAttr.composedTileCacheBytes < 0 ? 0 : _defaultComposedTileCacheBytes);
+    _composedTiles.configure(cacheBytes, tileBytes);
+    USB_SERIAL.printf("_composedTiles up to %lu bytes (%lu per tile)\n", cacheBytes, tileBytes);
+
+    // idle pre-rendering of the next zoom needs somewhere to compose and a second decode buffer
+    if (_composedTiles.isEnabled())
+    {
+      _prerenderSprite->setColorDepth(16);
+      _prerenderSprite->createSprite(getTFTWidth(),getTFTHeight());
+      if (_prerenderSprite->created())
+        pngPixelBuffers[1].resize(getTFTWidth() * getTFTHeight());
+      USB_SERIAL.printf("_prerenderSprite %s\n", (_prerenderSprite->created() ? "created" : "FAILED creation"));
+    }
+
+    // a sliced decode goes into the buffer not on screen
+    if (_mapAttr.pngSliceMicros > 0 && pngPixelBuffers[1].empty())
+      pngPixelBuffers[1].resize(getTFTWidth() * getTFTHeight());
   }
 
   void* created = nullptr;
@@ -264,31 +597,132 @@ void MapScreen_ex::initExitWaypoints()
   _exitWaypointCount = currentExitIndex+1;
 }
 
+void MapScreen_ex::initWaypointSpatialIndex()
+{
+  const uint32_t tStart = micros();
+
+  // the site origin is the centroid of the site's waypoints
+  if (_endWaypointsIndex > _firstWaypointIndex)
+  {
+    double sumLat = 0, sumLong = 0;
+    for (int i=_firstWaypointIndex; i < _endWaypointsIndex; i++)
+    {
+      sumLat += WraysburyWaypoints::waypoints[i]._lat;
+      sumLong += WraysburyWaypoints::waypoints[i]._long;
+    }
+    _siteFrame.setOrigin(sumLat / (_endWaypointsIndex - _firstWaypointIndex), sumLong / (_endWaypointsIndex - _firstWaypointIndex));
+  }
+
+  _waypointLocal.resize(std::max(_endWaypointsIndex - _firstWaypointIndex, 0));
+  for (int i=_firstWaypointIndex; i < _endWaypointsIndex; i++)
+    _waypointLocal[i - _firstWaypointIndex] = _siteFrame.toLocal(WraysburyWaypoints::waypoints[i]._lat, WraysburyWaypoints::waypoints[i]._long);
+
+  _labelIndex.build(WraysburyWaypoints::waypoints, _firstWaypointIndex, _endWaypointsIndex);
+  _featureGrid.build(_siteFrame, WraysburyWaypoints::waypoints, _firstWaypointIndex, _endWaypointsIndex, TinyGPSPlus::distanceBetweenAccurate);
+  _exitGrid.build(_siteFrame, WraysburyWaypoints::waypoints, _exitWaypointIndices.data(), _exitWaypointCount, TinyGPSPlus::distanceBetweenAccurate);
+
+  _featureGridFirstIndex = _firstWaypointIndex;
+  _featureGridEndIndex = _endWaypointsIndex;
+
+  // cached tiles carry the old range's features
+  _composedTiles.clear();
+
+  _nearestFeatureTracker.reset();
+
+  _exitRaster.clear();
+  _exitRasterAttempted = false;
+
+  USB_SERIAL.printf("initWaypointSpatialIndex: origin %.6f,%.6f %d labels, %d features, %d exits indexed in %luus\n",
+                    _siteFrame.originLat(), _siteFrame.originLong(), _labelIndex.size(), _featureGrid.size(), _exitGrid.size(), micros()-tStart);
+}
+
+void MapScreen_ex::ensureWaypointIndices()
+{
+  if (_featureGridFirstIndex != _firstWaypointIndex || _featureGridEndIndex != _endWaypointsIndex)
+    initWaypointSpatialIndex();
+}
+
+void MapScreen_ex::ensureMapExtentIndex()
+{
+  if (!_mapExtents.isEmpty())
+    return;
+
+  for (int i = getFirstDetailMapIndex(); i < getEndDetailMaps(); i++)
+    _mapExtents.add(i, true, _maps[i].mapLongitudeLeft, _maps[i].mapLongitudeRight, _maps[i].mapLatitudeBottom, getTFTWidth(), getTFTHeight());
+
+  const geo_map& allMap = _maps[getAllMapIndex()];
+  _mapExtents.add(getAllMapIndex(), false, allMap.mapLongitudeLeft, allMap.mapLongitudeRight, allMap.mapLatitudeBottom, getTFTWidth(), getTFTHeight());
+}
+
 void MapScreen_ex::initCurrentMap(const double diverLatitude, const double diverLongitude)
 {  
   _currentMap = _maps+getAllMapIndex();
+  _proposedMap = nullptr;
 
-  pixel p;
-  
   // identify first map that includes diver location within extent
-  for (uint8_t i = getFirstDetailMapIndex(); i<getEndDetailMaps(); i++)
+  ensureMapExtentIndex();
+  const int i = _mapExtents.firstContaining(diverLatitude, diverLongitude);
+  if (i >= 0)
+  {
+    scalePixelForZoomedInTile(convertGeoToPixelDouble(diverLatitude, diverLongitude, _maps[i]),_tileXToDisplay, _tileYToDisplay);
+    _currentMap = _maps+i;
+  }
+}
+
+const MapScreen_ex::geo_map* MapScreen_ex::applyMapSwitchHysteresis(const geo_map* proposed, const double diverLatitude, const double diverLongitude)
+{
+  if (proposed == _currentMap || _currentMap == nullptr)
   {
-    p = convertGeoToPixelDouble(diverLatitude, diverLongitude, _maps[i]);
+    if (_proposedMap != nullptr && !_proposedPassed)
+    {
+      _mapSwitchesAvoided++;
+      USB_SERIAL.printf("MAP HYSTERESIS: switch to '%s' withdrawn (%lu avoided)\n", _proposedMap->label, _mapSwitchesAvoided);
+    }
+    _proposedMap = nullptr;
+    return proposed;
+  }
 
-    if (p.x >= 0 && p.x < getTFTWidth() && p.y >=0 && p.y < getTFTHeight())
+  // measured past the current map's edge, so it is the boundary and not wherever the switch happened to be proposed
+  ensureMapExtentIndex();
+  float beyond;
+  if (_mapExtents.holdsSwitchFrom(_currentMap - _maps, diverLatitude, diverLongitude, _siteFrame, _mapAttr.mapSwitchHysteresisMetres, beyond))
+  {
+    if (proposed != _proposedMap)
     {
-      scalePixelForZoomedInTile(p,_tileXToDisplay, _tileYToDisplay);
-      _currentMap = _maps+i;
-      break;
+      _proposedMap = proposed;
+      _proposedPassed = false;
     }
+    return _currentMap;
   }
+
+  // counted once: a sliced decode may hold the old map a while longer, and the switch is asked for again each fix
+  if (proposed == _proposedMap && _proposedPassed)
+    return proposed;
+
+  _proposedMap = proposed;
+  _proposedPassed = true;
+  _mapSwitches++;
+
+  const uint32_t now = millis();
+  const bool thrash = (proposed == _mapSwitchedFrom && now - _mapSwitchedMs < _mapThrashWindowMs);
+  if (thrash)
+    _mapSwitchThrash++;
+  _mapSwitchedFrom = _currentMap;
+  _mapSwitchedMs = now;
+
+  USB_SERIAL.printf("MAP HYSTERESIS: '%s' -> '%s' %.1fm past its edge%s (%lu switches, %lu straight back, %lu avoided)\n", _currentMap->label, proposed->label,
+                    beyond, (thrash ? ", THRASH" : ""), _mapSwitches, _mapSwitchThrash, _mapSwitchesAvoided);
+  return proposed;
 }
 
 void MapScreen_ex::clearMap(const bool clearToBlack)
 {
   _currentMap = nullptr;
+  _proposedMap = nullptr;
   _prevZoom = _zoom = 1;
+  _fractionalZoom = 0;
   _tileXToDisplay = _tileYToDisplay = 0;
+  _deadReckoner.reset();
   if (clearToBlack)
     fillScreen(TFT_BLACK);
 }
@@ -296,17 +730,16 @@ void MapScreen_ex::clearMap(const bool clearToBlack)
 void MapScreen_ex::setTargetWaypointByLabel(const char* label)
 {
   _prevWaypointIndex = _targetWaypointIndex;
-  _targetWaypointIndex = -1;
-  const int numberCharsToCompare = 3;
-  // find targetWayPoint in the NavigationWaypoints array by first 3 chars
-  for (int i=_firstWaypointIndex; i < _endWaypointsIndex; i++)
-  {
-    if (strncmp(WraysburyWaypoints::waypoints[i]._label, label, numberCharsToCompare) == 0)
-    {
-      _targetWaypointIndex=i;
-      break;
-    }
-  }
+
+  // find targetWayPoint by first 3 chars of its label
+  ensureWaypointIndices();
+  _targetWaypointIndex = _labelIndex.findExact(label);
+}
+
+int MapScreen_ex::findWaypointsByLabelPrefix(const char* prefix, int* indices, const int maxIndices)
+{
+  ensureWaypointIndices();
+  return _labelIndex.findPrefix(prefix, indices, maxIndices);
 }
 
 void MapScreen_ex::setZoom(const int16_t zoom)
@@ -319,15 +752,64 @@ void MapScreen_ex::setZoom(const int16_t zoom)
    }
 
   _zoom = zoom;
+  _fractionalZoom = 0;
   USB_SERIAL.printf("switch to zoom %hu normal map\n",zoom);
 }
+
+void MapScreen_ex::setFractionalZoom(const float zoom)
+{
+  const uint32_t fixed = std::max(1.0f, std::min(zoom, 4.0f)) * ZoomScale::s_one + 0.5f;
+
+  // tiles as for the next whole zoom up, the last across and down partly off the map
+  setZoom((fixed + ZoomScale::s_one - 1) >> 16);
+  if (fixed & (ZoomScale::s_one - 1))
+  {
+    _fractionalZoom = fixed;
+    _zoomScale.set(fixed, getTFTWidth(), getTFTHeight());
+    USB_SERIAL.printf("switch to zoom %.2f normal map\n", getZoomScale());
+  }
+}
     
+void MapScreen_ex::setHeadingUp(const bool headingUp)
+{
+  if (headingUp == _headingUp)
+    return;
+
+  // the turned base is another screen buffer, so it's only made once heading-up is first asked for
+  if (headingUp && useBaseMapCache() && !_headingUpSprite->created())
+  {
+    _headingUpSprite->setColorDepth(16);
+    _headingUpSprite->createSprite(getTFTWidth(),getTFTHeight());
+    USB_SERIAL.printf("_headingUpSprite %s\n", (_headingUpSprite->created() ? "created" : "FAILED creation"));
+  }
+
+  _headingUp = headingUp;
+  _headingUpValid = false;
+}
+
+bool MapScreen_ex::isHeadingUpAvailable() const
+{
+  return _headingUp && useBaseMapCache() && _headingUpSprite->created();
+}
+
+MapScreen_ex::pixel MapScreen_ex::toHeadingUp(const pixel p) const
+{
+  if (!_headingUpDrawing)
+    return p;
+
+  pixel turned(0, 0, p.colour);
+  _headingUpBlit.toScreen(p.x, p.y, turned.x, turned.y);
+  return turned;
+}
+
 void MapScreen_ex::setAllLakeShown(bool showAll)
 { 
   if (_showAllLake && showAll || 
       !_showAllLake && !showAll)
     return;
 
+  _fractionalZoom = 0;
+
   if (showAll)
   {
     _showAllLake = true;
@@ -346,7 +828,9 @@ void MapScreen_ex::setAllLakeShown(bool showAll)
 
 void MapScreen_ex::cycleZoom()
 { 
+  _zoomCycleStartUs = micros();
   _prevZoom = _zoom;
+  _fractionalZoom = 0;
 
   if (_showAllLake)
   {
@@ -382,8 +866,60 @@ void MapScreen_ex::cycleZoom()
   }
 }
 
+void MapScreen_ex::ensureExitRaster()
+{
+  if (_exitRasterAttempted)
+    return;
+
+  _exitRasterAttempted = true;
+
+  char filename[48];
+  snprintf(filename, sizeof(filename), "/exits_%s.bin", getLocationName(_location));
+
+  const uint32_t tStart = micros();
+
+  if (_exitRaster.load(filename, _siteFrame, WraysburyWaypoints::waypoints, _firstWaypointIndex, _endWaypointsIndex,
+                       _exitWaypointIndices.data(), _exitWaypointCount))
+  {
+    USB_SERIAL.printf("ensureExitRaster: loaded %s (%lu bytes) in %luus\n", filename, _exitRaster.sizeBytes(), micros()-tStart);
+    return;
+  }
+
+  if (!_exitRaster.build(_siteFrame, WraysburyWaypoints::waypoints, _firstWaypointIndex, _endWaypointsIndex,
+                         _exitWaypointIndices.data(), _exitWaypointCount))
+  {
+    USB_SERIAL.println("ensureExitRaster: build FAILED, using grid search for nearest exit");
+    return;
+  }
+
+  const uint32_t tBuilt = micros();
+  const bool saved = _exitRaster.save(filename);
+
+  USB_SERIAL.printf("ensureExitRaster: built %lu bytes in %luus, save to %s %s in %luus\n",
+                    _exitRaster.sizeBytes(), tBuilt-tStart, filename, (saved ? "done" : "FAILED"), micros()-tBuilt);
+}
+
 int MapScreen_ex::getClosestJettyIndex(double& shortestDistance, bool useFastApprox)
 {
+  ensureWaypointIndices();
+
+  if (useFastApprox)
+  {
+    // One raster read, then actual metres for the winner — used by the UI
+    ensureExitRaster();
+    const int rasterExitIndex = _exitRaster.lookup(_lastDiverLatitude, _lastDiverLongitude);
+    if (rasterExitIndex != -1)
+    {
+      shortestDistance = siteDistanceToWaypoint(_lastDiverLatitude, _lastDiverLongitude, rasterExitIndex);
+      return rasterExitIndex;
+    }
+  }
+
+  // Grid search returns the exact-distance winner in both modes - useFastApprox only matters for the linear fallback
+  const int exitIndex = _exitGrid.nearest(_lastDiverLatitude, _lastDiverLongitude, shortestDistance);
+  if (exitIndex != -1)
+    return exitIndex;
+
   int closestExitWaypointIndex = 0;
 
   if (useFastApprox)
@@ -418,8 +954,15 @@ int MapScreen_ex::getClosestJettyIndex(double& shortestDistance, bool useFastApp
   return _exitWaypointIndices[closestExitWaypointIndex];
 }
 
-int MapScreen_ex::getClosestFeatureIndex(double& shortestDistance, bool useFastApprox)
+int MapScreen_ex::getClosestFeatureIndex(double& shortestDistance, bool useFastApprox, const uint16_t categoryMask)
 {
+  ensureWaypointIndices();
+
+  // Grid search returns the exact-distance winner in both modes - useFastApprox only matters for the linear fallback
+  const int featureIndex = _featureGrid.nearest(_lastDiverLatitude, _lastDiverLongitude, shortestDistance, categoryMask);
+  if (featureIndex != -1)
+    return featureIndex;
+
   int closestFeatureIndex = _firstWaypointIndex;
 
   if (useFastApprox)
@@ -429,6 +972,9 @@ int MapScreen_ex::getClosestFeatureIndex(double& shortestDistance, bool useFastA
     double shortestD2 = 1e99;
     for (int i=_firstWaypointIndex; i < _endWaypointsIndex; i++)
     {
+      if ((WaypointGrid::categoryBit(WraysburyWaypoints::waypoints[i]._cat) & categoryMask) == 0)
+        continue;
+
       const double dlat = WraysburyWaypoints::waypoints[i]._lat - _lastDiverLatitude;
       const double dlon = (WraysburyWaypoints::waypoints[i]._long - _lastDiverLongitude) * clat;
       const double d2 = dlat*dlat + dlon*dlon;
@@ -440,6 +986,9 @@ int MapScreen_ex::getClosestFeatureIndex(double& shortestDistance, bool useFastA
     shortestDistance = 1e99;
     for (int i=_firstWaypointIndex; i < _endWaypointsIndex; i++)
     {
+      if ((WaypointGrid::categoryBit(WraysburyWaypoints::waypoints[i]._cat) & categoryMask) == 0)
+        continue;
+
       const double distance = distanceBetween(_lastDiverLatitude, _lastDiverLongitude, WraysburyWaypoints::waypoints[i]._lat, WraysburyWaypoints::waypoints[i]._long);
       if (distance < shortestDistance) { shortestDistance = distance; closestFeatureIndex = i; }
     }
@@ -453,23 +1002,48 @@ int MapScreen_ex::getClosestFeatureIndex(double& shortestDistance, bool useFastA
   return closestFeatureIndex;
 }
 
-void MapScreen_ex::drawPNG(const char* filename, bool swapBytes)
+int MapScreen_ex::getTrackedNearestFeatureIndex(double& shortestDistance)
+{
+  ensureWaypointIndices();
+
+  const int featureIndex = _nearestFeatureTracker.update(_lastDiverLatitude, _lastDiverLongitude, shortestDistance);
+  if (featureIndex != -1)
+    return featureIndex;
+
+  return getClosestFeatureIndex(shortestDistance, true);
+}
+
+const uint16_t* MapScreen_ex::drawPNG(const char* filename, bool swapBytes)
 {
   // Automatic PNG loading for map rendering
-  if (!filename || !useBaseMapCache() || pngPixelBuffer.empty()) {
-      return;
+  if (!filename || !useBaseMapCache() || pngPixelBuffers[0].empty()) {
+      return nullptr;
   }
 
-  // Skip decode if this PNG is already in the buffer — zoom/tile changes reuse the existing decode
-  if (lastLoadedPngFilename == filename) {
-      USB_SERIAL.printf("  → PNG cache hit, reusing buffer: %s\n", filename);
-      return;
+  // Skip decode if this PNG is already in a buffer — zoom/tile changes reuse the existing decode
+  for (int b = 0; b < 2; b++) {
+      if (!pngPixelBuffers[b].empty() && pngBufferFilenames[b] == filename) {
+          USB_SERIAL.printf("  → PNG cache hit, reusing buffer %d: %s\n", b, filename);
+          pngLastUsedBuffer = b;
+          return pngPixelBuffers[b].data();
+      }
   }
 
+  // the decoder is free once any sliced decode finishes, which may have been of this PNG
+  finishSlicedPngDecode();
+  if (const uint16_t* pixels = decodedPngPixels(filename))
+      return pixels;
+
+  // Decode over the buffer used least recently
+  const int b = (pngPixelBuffers[1].empty() ? 0 : 1 - pngLastUsedBuffer);
+  std::vector<uint16_t>& pngPixelBuffer = pngPixelBuffers[b];
+  pngDecodeTarget = &pngPixelBuffer;
+  pngBufferFilenames[b].clear();
+  pngLastUsedBuffer = b;
+
   if (!LittleFS.exists(filename)) {
       USB_SERIAL.printf("PNG file not found: %s\n", filename);
-      lastLoadedPngFilename.clear();
-      return;
+      return nullptr;
   }
 
   int16_t rc = png.open(filename, pngOpenLFS, pngClose, pngRead, pngSeek, pngDrawToSprite);
@@ -477,8 +1051,7 @@ void MapScreen_ex::drawPNG(const char* filename, bool swapBytes)
   if (rc != PNG_SUCCESS) {
       USB_SERIAL.printf("png.open() failed: %d\n", rc);
       std::fill(pngPixelBuffer.begin(), pngPixelBuffer.end(), PURPLE);  // Purple on open error
-      lastLoadedPngFilename.clear();
-      return;
+      return pngPixelBuffer.data();
   }
 
   rc = png.decode(NULL, 0);
@@ -487,16 +1060,18 @@ void MapScreen_ex::drawPNG(const char* filename, bool swapBytes)
       USB_SERIAL.printf("png.decode() failed: %d\n", rc);
       png.close();
       std::fill(pngPixelBuffer.begin(), pngPixelBuffer.end(), PINK);  // Pink on decode error
-      lastLoadedPngFilename.clear();
-      return;
+      return pngPixelBuffer.data();
   }
 
   png.close();
-  lastLoadedPngFilename = filename;
+  pngBufferFilenames[b] = filename;
+  return pngPixelBuffer.data();
 }
 
 void MapScreen_ex::testDrawPNG(const char* filename, bool swapBytes)
 {
+  redrawNextFrame();
+
   // Test function for manual PNG drawing with verbose output
   // First check if file exists
   if (!LittleFS.exists(filename)) {
@@ -514,7 +1089,13 @@ void MapScreen_ex::testDrawPNG(const char* filename, bool swapBytes)
   testFile.close();
   
   USB_SERIAL.printf("Opening PNG: %s (size: %d bytes)\n", filename, fileSize);
+
+  finishSlicedPngDecode();
   
+  // decodes over the first buffer, so it no longer holds the map PNG it did
+  pngDecodeTarget = &pngPixelBuffers[0];
+  pngBufferFilenames[0].clear();
+
   int16_t rc = png.open(filename, pngOpenLFS, pngClose, pngRead, pngSeek, pngDrawToSprite);
 
   if (rc != PNG_SUCCESS) {
@@ -548,7 +1129,7 @@ void MapScreen_ex::testDrawPNG(const char* filename, bool swapBytes)
   png.close();
   
   // Display the decoded PNG buffer directly
-  copyFullScreenBufferToDisplay(pngPixelBuffer.data());
+  copyFullScreenBufferToDisplay(pngPixelBuffers[0].data());
 }
 
 void MapScreen_ex::drawDiverOnBestFeaturesMapAtCurrentZoom(const double diverLatitude, const double diverLongitude, const double diverHeading)
@@ -565,12 +1146,39 @@ void MapScreen_ex::drawDiverOnBestFeaturesMapAtCurrentZoom(const double diverLat
   _lastDiverLongitude = diverLongitude;
   _lastDiverHeading = diverHeading;
 
+  // a fix within GPS noise of the last frame, with nothing else changed, would draw the same pixels again
+  const DrawnFrame frame = frameToDraw(diverLatitude, diverLongitude, diverHeading);
+  if (_mapAttr.interpolatedFrameHz > 0)
+    _deadReckoner.addFix(frame.position, diverHeading, millis());
+
+  if (isFrameUnchanged(frame))
+  {
+    _framesSkipped++;
+    _framesSkippedSinceDrawn++;
+    return;
+  }
+
+  if (_framesSkippedSinceDrawn > 0)
+  {
+    USB_SERIAL.printf("FRAME SKIP: drawing after %lu skipped (%lu skipped, %lu drawn)\n", _framesSkippedSinceDrawn, _framesSkipped, _framesDrawn);
+    _framesSkippedSinceDrawn = 0;
+  }
+
+  _frameBudget.beginFrame(_mapAttr.frameBudgetMicros > 0 ? _mapAttr.frameBudgetMicros : 0, t0);
+
   bool forceFirstMapDraw = false;
 
+  // column and row tables are rebuilt only when the zoom has changed
+  _zoomScale.set(zoomFixed(), getTFTWidth(), getTFTHeight());
+
   if (_currentMap == nullptr)
   {
     initCurrentMap(diverLatitude, diverLongitude);
     forceFirstMapDraw=true;
+
+    _mapSwitchTarget = _currentMap;
+    _mapSwitchStartUs = t0;
+    _mapSwitchShown = false;
   }
 
   // Determine the next map - check all lake first
@@ -579,28 +1187,48 @@ void MapScreen_ex::drawDiverOnBestFeaturesMapAtCurrentZoom(const double diverLat
   {
     // If showing all lake, always use the all map regardless of position
     nextMap = getMaps() + getAllMapIndex();
+    noteMapWanted(nextMap, t0);
     USB_SERIAL.printf("All Lake mode: nextMap=%s (index=%d) currentMap=%s (index=%d)\n", nextMap->label, (int)(nextMap - getMaps()), _currentMap ? _currentMap->label : "null", (_currentMap ? (int)(_currentMap - getMaps()) : -1));
   }
   else
   {
     // Calculate pixel location and use location-based logic
     pixel p = convertGeoToPixelDouble(diverLatitude, diverLongitude, *_currentMap);
-    nextMap = getNextMapByPixelLocation(p, _currentMap);
+    nextMap = applyMapSwitchHysteresis(getNextMapByPixelLocation(p, _currentMap), diverLatitude, diverLongitude);
+    noteMapWanted(nextMap, t0);
+
+    // with sliced decoding a new map goes up from its thumbnail, else the old map stays up with the decode's progress
+    // over it, until the new map's image is whole; a decode left behind by turning back runs on meanwhile
+    if (!isMapImageReady(*nextMap) && nextMap != _currentMap && !showsThumbnail(*nextMap))
+      nextMap = _currentMap;
     USB_SERIAL.printf("After getNextMapByPixelLocation: nextMap=%s (index=%d) currentMap=%s (index=%d)\n", nextMap->label, (int)(nextMap - getMaps()), _currentMap ? _currentMap->label : "null", (_currentMap ? (int)(_currentMap - getMaps()) : -1));
   }
 
   // Now calculate pixel in the correct map coordinate system
   pixel p = convertGeoToPixelDouble(diverLatitude, diverLongitude, *nextMap);
 
+  // pan the view with the diver where the map image is to hand to pan over, else fixed tiles
+  const bool wasPanning = _panning;
+  const uint16_t* panSource = (isPanningAvailable() ? panSourcePixels(*nextMap) : nullptr);
+  _panning = (panSource != nullptr);
+  if (_panning)
+  {
+    double diverX, diverY;
+    convertGeoToFractionalPixel(diverLatitude, diverLongitude, *nextMap, diverX, diverY);
+    _panViewport.follow(diverX * _zoomScale.value(), diverY * _zoomScale.value(), _zoomScale, getTFTWidth(), getTFTHeight(), _mapAttr.panDeadbandPixels,
+                        !wasPanning || nextMap != _currentMap);
+  }
+
   int16_t prevTileX = _tileXToDisplay;
   int16_t prevTileY = _tileYToDisplay;
 
   p = scalePixelForZoomedInTile(p,_tileXToDisplay,_tileYToDisplay);
 
-  if (_prevZoom != _zoom)
+  if (_prevZoom != _zoom || _drawnZoomFixed != _zoomScale.fixed())
   {
     forceFirstMapDraw = true;
     _prevZoom = _zoom;
+    _drawnZoomFixed = _zoomScale.fixed();
   }
 
   // Force redraw when entering/exiting all lake mode
@@ -611,103 +1239,182 @@ void MapScreen_ex::drawDiverOnBestFeaturesMapAtCurrentZoom(const double diverLat
     prevShowAllLake = isAllLakeShown();
   }
 
+  // the base sprite held the viewport's ring, not a tile
+  if (wasPanning && !_panning)
+    forceFirstMapDraw = true;
+
+  // the image the thumbnail stood in for has finished decoding
+  if (_baseFromThumbnail && !showsThumbnail(*nextMap))
+    forceFirstMapDraw = true;
+
   const uint32_t t1 = micros();
 
-  if (!useBaseMapCache() || nextMap != _currentMap || prevTileX != _tileXToDisplay || prevTileY != _tileYToDisplay || forceFirstMapDraw)
+  // whether the unturned base differs from the one last turned for heading-up
+  bool baseChanged = (_panning && _staticOverlaysDirty);
+
+  if (_panning)
+  {
+    const uint32_t tPanStart = micros();
+    const uint32_t filled = _panViewport.update((uint16_t*)_baseMap->getPointer(), panSource, _zoomScale, nextMap->swapBytes);
+    _baseFromThumbnail = false;
+    baseChanged |= (filled > 0);
+    if (filled > 0)
+      USB_SERIAL.printf("PAN: origin %ld,%ld zoom=%.2f filled %lu pixels in %luus\n", _panViewport.originX(), _panViewport.originY(),
+                        _zoomScale.value(), filled, micros()-tPanStart);
+  }
+  else if (!useBaseMapCache() || nextMap != _currentMap || prevTileX != _tileXToDisplay || prevTileY != _tileYToDisplay || forceFirstMapDraw ||
+      _staticOverlaysDirty)
   {
-    USB_SERIAL.printf("MAP REDRAW: nextMap=%s (png=%s) currentMap=%s zoom=%d forceFirstMapDraw=%d\n",
+    USB_SERIAL.printf("MAP REDRAW: nextMap=%s (png=%s) currentMap=%s zoom=%.2f forceFirstMapDraw=%d staticOverlaysDirty=%d\n",
                       nextMap->label, nextMap->png ? nextMap->png : "none",
-                      (_currentMap ? _currentMap->label : "null"), _zoom, forceFirstMapDraw);
+                      (_currentMap ? _currentMap->label : "null"), _zoomScale.value(), forceFirstMapDraw, _staticOverlaysDirty);
+    baseChanged = true;
 
-    if (useBaseMapCache() && nextMap->png)
+    const ComposedTileCache::Key tileKey = { nextMap, _zoomScale.fixed(), _tileXToDisplay, _tileYToDisplay, _drawAllFeatures };
+
+    _lastBaseTileFromCache = (useBaseMapCache() && _composedTiles.fetch(tileKey, _baseMap->getPointer()));
+    _baseFromThumbnail = (!_lastBaseTileFromCache && showsThumbnail(*nextMap));
+    if (_lastBaseTileFromCache)
+    {
+      USB_SERIAL.printf("  → Composed tile cache hit (%lu hits, %lu misses, %d tiles)\n",
+                        _composedTiles.hits(), _composedTiles.misses(), _composedTiles.slotsAllocated());
+    }
+    else if (composeBaseTile(*nextMap, *_baseMap) && useBaseMapCache())
     {
-      USB_SERIAL.printf("  → Loading PNG: %s\n", nextMap->png);
-      const uint32_t tPngStart = micros();
-      drawPNG(nextMap->png, nextMap->swapBytes);
-      const uint32_t tPngEnd = micros();
+      // keep the tile before the overlays go on, so editing an overlay never evicts it
+      _composedTiles.store(tileKey, _baseMap->getPointer());
+    }
 
-      if (!pngPixelBuffer.empty())
-      {
-        const uint32_t tScaleStart = micros();
-        _baseMap->pushImageScaled(0, 0, getTFTWidth(), getTFTHeight(), _zoom, _tileXToDisplay, _tileYToDisplay,
-                                                    pngPixelBuffer.data(), nextMap->swapBytes);
-        const uint32_t tScaleEnd = micros();
+    // static overlays only change with the map, zoom and tile, or when invalidated
+    const uint32_t tStaticStart = micros();
+    drawStaticOverlaysToSprite(*_baseMap, _tileXToDisplay, _tileYToDisplay, *nextMap);
+    USB_SERIAL.printf("  TIMING: static overlays=%luus\n", micros()-tStaticStart);
+  }
 
-        if (_drawAllFeatures)
-        {
-          drawFeaturesOnBaseMapSprite(*nextMap, *_baseMap);
-        }
+  const uint32_t t2 = micros();
 
-        drawMapScaleToSprite(*_baseMap, *nextMap);
-        USB_SERIAL.printf("  TIMING: drawPNG=%luus pushImageScaled=%luus\n", tPngEnd-tPngStart, tScaleEnd-tScaleStart);
-      }
-      else
-      {
-        _baseMap->fillSprite(nextMap->backColour);
-        drawFeaturesOnBaseMapSprite(*nextMap, *_baseMap);
-      }
-    }
-    else if (nextMap->mapData)
-    {
-      // Flash-based map data (fallback when PNG not available or cache disabled)
-      const uint32_t tScaleStart = micros();
-      _baseMap->pushImageScaled(0, 0, getTFTWidth(), getTFTHeight(), _zoom, _tileXToDisplay, _tileYToDisplay,
-                                                  nextMap->mapData, nextMap->swapBytes);
-      const uint32_t tScaleEnd = micros();
+  const bool headingUp = isHeadingUpAvailable();
+  const int threshold = (_mapAttr.headingUpThresholdDegrees > 0 ? _mapAttr.headingUpThresholdDegrees : _defaultHeadingUpThresholdDegrees);
+  const double headingMoved = fabs(fmod(diverHeading - _headingUpHeading + 540.0, 360.0) - 180.0);
 
-      if (_drawAllFeatures)
-      {
-        drawFeaturesOnBaseMapSprite(*nextMap, *_baseMap);
-      }
+  // the map turns about the diver, wherever the tile has it, and the diver is moved to the middle of the screen
+  int16_t pivotTileX = 0, pivotTileY = 0;
+  const pixel pivot = (headingUp ? scalePixelForZoomedInTile(convertGeoToPixelDouble(diverLatitude, diverLongitude, *nextMap), pivotTileX, pivotTileY)
+                                 : pixel(0, 0));
+  const bool pivotMoved = (abs(pivot.x - _headingUpPivot.x) >= _headingUpRecentrePixels || abs(pivot.y - _headingUpPivot.y) >= _headingUpRecentrePixels);
+  const bool turnBase = headingUp && (baseChanged || !_headingUpValid || headingMoved >= threshold || pivotMoved);
 
-      drawMapScaleToSprite(*_baseMap, *nextMap);
-      USB_SERIAL.printf("  TIMING: pushImageScaled(mapData)=%luus\n", tScaleEnd-tScaleStart);
-    }
-    else
-    {
-      _baseMap->fillSprite(nextMap->backColour);
-      drawFeaturesOnBaseMapSprite(*nextMap, *_baseMap);
-    }
+  if (_panning && (!headingUp || turnBase))
+  {
+    composePanningBase(*nextMap);
   }
-
-  const uint32_t t2 = micros();
-
-  if (useBaseMapCache())
+  else if (useBaseMapCache() && !headingUp)
   {
       _baseMapCacheSprite->pushToSprite(*_compositedScreenSprite, 0, 0);
   }
   // else: _baseMap IS _compositedScreenSprite already — no copy needed
 
+  if (turnBase)
+  {
+    // held until the heading moves past the threshold, so small wobbles cost a copy rather than a rotate
+    const uint32_t tTurnStart = micros();
+    const uint16_t* unturned = (const uint16_t*)(_panning ? _compositedScreenSprite->getPointer() : _baseMapCacheSprite->getPointer());
+    _headingUpHeading = diverHeading;
+    _headingUpPivot = pivot;
+    _headingUpBlit.setRotation(-diverHeading, getTFTWidth(), getTFTHeight(), pivot.x + 0.5f, pivot.y + 0.5f,
+                               getTFTWidth() / 2, getTFTHeight() / 2);
+    _headingUpBlit.blit((uint16_t*)_headingUpSprite->getPointer(), unturned,
+                        (uint16_t)((nextMap->backColour >> 8) | (nextMap->backColour << 8)));    // as fillSprite stores it
+    _headingUpValid = true;
+    USB_SERIAL.printf("HEADING UP: turned base to %.0f degrees in %luus\n", diverHeading, micros()-tTurnStart);
+  }
+
+  if (headingUp)
+    _headingUpSprite->pushToSprite(*_compositedScreenSprite, 0, 0);
+
+  // everything drawn in tile pixels from here on goes through the same matrix as the base
+  _headingUpDrawing = headingUp;
+
+  // the diver and the lines from it ease between fixes when interpolating; everything worked out from the fix uses the fix
+  double shownLatitude = diverLatitude, shownLongitude = diverLongitude, shownHeading = diverHeading;
+  estimateShownDiver(millis(), *nextMap, shownLatitude, shownLongitude, shownHeading);
+
   const uint32_t t3 = micros();
 
-  drawTracesOnCompositeMapSprite(diverLatitude, diverLongitude, *nextMap);
+  // dynamic overlays, drawn every frame over the base as the frame budget allows
+  // a static overlay is already in the base, so nothing is owed for it
+  if (_overlayStatic[e_trace_overlay])
+  {
+    _frameBudget.layerCached(e_traces_layer);
+  }
+  else if (_frameBudget.decide(e_traces_layer, t3, false) == FrameBudget::e_draw)
+  {
+    drawTracesToSprite(*_compositedScreenSprite, _tileXToDisplay, _tileYToDisplay, *nextMap);
+    _frameBudget.layerDrawn(e_traces_layer, micros()-t3);
+  }
   const uint32_t t4 = micros();
 
-  drawBreadCrumbTrailOnCompositeMapSprite(diverLatitude, diverLongitude, diverHeading, *nextMap);
+  recordBreadCrumbTrail(diverLatitude, diverLongitude, diverHeading);
+  if (_overlayStatic[e_breadcrumb_overlay])
+  {
+    _frameBudget.layerCached(e_crumbs_layer);
+  }
+  else
+  {
+    const uint32_t tCrumbStart = micros();
+    const FrameBudget::decisions crumbs = _frameBudget.decide(e_crumbs_layer, tCrumbStart, true);
+    drawBreadCrumbTrailToSprite(*_compositedScreenSprite, _tileXToDisplay, _tileYToDisplay, *nextMap, crumbs == FrameBudget::e_defer);
+    if (crumbs == FrameBudget::e_draw)
+      _frameBudget.layerDrawn(e_crumbs_layer, micros()-tCrumbStart);
+  }
   const uint32_t t5 = micros();
 
-  drawPlacedPins(diverLatitude, diverLongitude, *nextMap);
+  if (_overlayStatic[e_pin_overlay])
+  {
+    _frameBudget.layerCached(e_pins_layer);
+  }
+  else if (_frameBudget.decide(e_pins_layer, t5, false) == FrameBudget::e_draw)
+  {
+    drawPlacedPinsToSprite(*_compositedScreenSprite, _tileXToDisplay, _tileYToDisplay, *nextMap);
+    _frameBudget.layerDrawn(e_pins_layer, micros()-t5);
+  }
   const uint32_t t6 = micros();
 
-  drawHeadingLineOnCompositeMapSprite(diverLatitude, diverLongitude, diverHeading, *nextMap);
+  const bool drawLines = (_frameBudget.decide(e_lines_layer, t6, false) == FrameBudget::e_draw);
+  if (drawLines)
+    drawHeadingLineOnCompositeMapSprite(shownLatitude, shownLongitude, shownHeading, *nextMap);
   const uint32_t t7 = micros();
 
-  _nearestExitBearing = drawDirectionalLineOnCompositeSprite(diverLatitude, diverLongitude, *nextMap,getClosestJettyIndex(_distanceToNearestExit, true), _mapAttr.nearestExitLineColour, _mapAttr.nearestExitLinePixelLength);
+  // the bearings are wanted whether or not the lines are drawn
+  const int exitIndex = getClosestJettyIndex(_distanceToNearestExit, true);
+  _nearestExitBearing = (drawLines ? drawDirectionalLineOnCompositeSprite(shownLatitude, shownLongitude, *nextMap,exitIndex, _mapAttr.nearestExitLineColour, _mapAttr.nearestExitLinePixelLength)
+                                   : siteDegreesCourseToWaypoint(shownLatitude, shownLongitude, exitIndex));
   const uint32_t t8 = micros();
 
-  _targetBearing = drawDirectionalLineOnCompositeSprite(diverLatitude, diverLongitude, *nextMap,_targetWaypointIndex, _mapAttr.targetLineColour, _mapAttr.targetLinePixelLength);
+  _targetBearing = (drawLines ? drawDirectionalLineOnCompositeSprite(shownLatitude, shownLongitude, *nextMap,_targetWaypointIndex, _mapAttr.targetLineColour, _mapAttr.targetLinePixelLength)
+                              : siteDegreesCourseToWaypoint(shownLatitude, shownLongitude, _targetWaypointIndex));
   const uint32_t t9 = micros();
+  if (drawLines)
+    _frameBudget.layerDrawn(e_lines_layer, t9-t6);
 
-  _targetDistance = distanceBetween(diverLatitude, diverLongitude, WraysburyWaypoints::waypoints[_targetWaypointIndex]._lat, WraysburyWaypoints::waypoints[_targetWaypointIndex]._long);
-  _nearestFeatureIndex = getClosestFeatureIndex(_nearestFeatureDistance, true);
-  // _nearestFeatureDistance is set by getClosestFeatureIndex — no second distanceBetween call needed
-  _nearestFeatureBearing = degreesCourseTo(diverLatitude, diverLongitude, WraysburyWaypoints::waypoints[_nearestFeatureIndex]._lat, WraysburyWaypoints::waypoints[_nearestFeatureIndex]._long);
+  _targetDistance = siteDistanceToWaypoint(diverLatitude, diverLongitude, _targetWaypointIndex);
+  _nearestFeatureIndex = getTrackedNearestFeatureIndex(_nearestFeatureDistance);
+  // _nearestFeatureDistance is set by the tracker — no second distanceBetween call needed
+  _nearestFeatureBearing = siteDegreesCourseToWaypoint(diverLatitude, diverLongitude, _nearestFeatureIndex);
   const uint32_t t10 = micros();
 
-  writeMapTitleToSprite(*_compositedScreenSprite, *nextMap);
+  if (_frameBudget.decide(e_title_layer, t10, false) == FrameBudget::e_draw)
+  {
+    writeMapTitleToSprite(*_compositedScreenSprite, *nextMap);
+    _frameBudget.layerDrawn(e_title_layer, micros()-t10);
+  }
   const uint32_t t11 = micros();
 
-  drawDiverOnCompositedMapSprite(diverLatitude, diverLongitude, diverHeading, *nextMap);
+  drawDiverOnCompositedMapSprite(shownLatitude, shownLongitude, shownHeading, *nextMap);
+  _headingUpDrawing = false;
+
+  if (isMapDecoding())
+    drawMapDecodeProgress(*_compositedScreenSprite);
   const uint32_t t12 = micros();
 
   copyFullScreenSpriteToDisplay(*_compositedScreenSprite);
@@ -716,7 +1423,504 @@ void MapScreen_ex::drawDiverOnBestFeaturesMapAtCurrentZoom(const double diverLat
   USB_SERIAL.printf("DRAW TIMING (us): setup=%lu baseMap=%lu pushToComp=%lu traces=%lu bread=%lu pins=%lu heading=%lu exitLine=%lu targetLine=%lu geo=%lu title=%lu diver=%lu display=%lu TOTAL=%lu\n",
     t1-t0, t2-t1, t3-t2, t4-t3, t5-t4, t6-t5, t7-t6, t8-t7, t9-t8, t10-t9, t11-t10, t12-t11, t13-t12, t13-t0);
 
+  if (_frameBudget.endFrame(t13))
+    logFrameBudgetMiss();
+
+  if (_zoomCycleStartUs != 0)
+  {
+    USB_SERIAL.printf("cycleZoom: press to frame %luus, base tile %s\n", t13 - _zoomCycleStartUs,
+                      (_lastBaseTileFromCache ? "from cache" : "composed"));
+    _zoomCycleStartUs = 0;
+  }
+
+  noteMapSwitchFrame(nextMap, t13);
+
+  if (!_showAllLake)
+    _lastDetailMap = nextMap;
+
   _currentMap = nextMap;
+  _drawnFrame = frame;
+  _framesDrawn++;
+  _lastFrameMs = millis();
+
+  logInterpolatedFrames();
+}
+
+void MapScreen_ex::logInterpolatedFrames()
+{
+  if (_interpolatedSinceFix == 0)
+    return;
+
+  USB_SERIAL.printf("INTERPOLATED FRAMES: %lu since last fix, mean draw=%luus display=%luus, longest %luus (%lu interpolated, %lu unchanged, %lu drawn)\n",
+                    _interpolatedSinceFix, _interpolatedDrawMicrosSinceFix / _interpolatedSinceFix, _interpolatedDisplayMicrosSinceFix / _interpolatedSinceFix,
+                    _interpolatedLongestMicrosSinceFix, _framesInterpolated, _framesInterpolationSkipped, _framesDrawn);
+
+  _interpolatedSinceFix = 0;
+  _interpolatedDrawMicrosSinceFix = 0;
+  _interpolatedDisplayMicrosSinceFix = 0;
+  _interpolatedLongestMicrosSinceFix = 0;
+}
+
+bool MapScreen_ex::isMapDecoding() const
+{
+  return pngSlicedDecode.isRunning();
+}
+
+void MapScreen_ex::continueMapDecode()
+{
+  if (isMapDecoding())
+    continueSlicedPngDecode(_mapAttr.pngSliceMicros, _mapAttr.pngSliceRows);
+}
+
+bool MapScreen_ex::isMapImageReady(const geo_map& map)
+{
+  // without the base map cache maps come from flash mapData, never a PNG, so there is no decode to slice
+  if (_mapAttr.pngSliceMicros <= 0 || !useBaseMapCache() || map.png == nullptr)
+    return true;
+
+  // one decode at a time: one left behind by turning back runs on, and this map's starts the frame after
+  if (!isPngDecoded(map.png) && !isMapDecoding())
+  {
+    // into the buffer not holding the map on screen, which the held frames may still pan over
+    if (_currentMap && _currentMap->png)
+      decodedPngPixels(_currentMap->png);
+
+    if (!startSlicedPngDecode(map.png, _pngSliceStackBytes))
+      return true;
+  }
+
+  continueMapDecode();
+  return isPngDecoded(map.png);
+}
+
+bool MapScreen_ex::showsThumbnail(const geo_map& map)
+{
+  return useBaseMapCache() && map.png && !isPngDecoded(map.png) && isPngDecodingSliced(map.png) &&
+         _thumbnail.load(map.png, getTFTWidth(), getTFTHeight());
+}
+
+void MapScreen_ex::noteMapWanted(const geo_map* map, const uint32_t startUs)
+{
+  if (map == _mapSwitchTarget)
+    return;
+
+  if (map == _currentMap)
+  {
+    _mapSwitchTarget = nullptr;     // turned back before the switch was shown
+    return;
+  }
+
+  _mapSwitchTarget = map;
+  _mapSwitchStartUs = startUs;
+  _mapSwitchShown = false;
+}
+
+void MapScreen_ex::noteMapSwitchFrame(const geo_map* shown, const uint32_t nowUs)
+{
+  if (_mapSwitchTarget == nullptr || shown != _mapSwitchTarget)
+    return;
+
+  if (!_mapSwitchShown)
+  {
+    _mapSwitchShown = true;
+    _firstUsefulFrameUs = nowUs - _mapSwitchStartUs;
+    USB_SERIAL.printf("MAP SWITCH: '%s' first useful frame in %luus (%s)\n", shown->label, _firstUsefulFrameUs,
+                      (_baseFromThumbnail ? "thumbnail" : "full"));
+  }
+
+  if (!_baseFromThumbnail)
+  {
+    _fullQualityFrameUs = nowUs - _mapSwitchStartUs;
+    _mapSwitchTarget = nullptr;
+    USB_SERIAL.printf("MAP SWITCH: '%s' full quality in %luus\n", shown->label, _fullQualityFrameUs);
+  }
+}
+
+void MapScreen_ex::drawMapDecodeProgress(TFT_eSprite& sprite) const
+{
+  const int height = png.getHeight();
+  const int16_t barHeight = 4;
+  const int16_t done = (height > 0 ? (int32_t)getTFTWidth() * pngDecodedRows / height : 0);
+
+  sprite.fillRect(0, getTFTHeight() - barHeight, getTFTWidth(), barHeight, TFT_BLACK);
+  sprite.fillRect(0, getTFTHeight() - barHeight, done, barHeight, TFT_WHITE);
+}
+
+void MapScreen_ex::logFrameBudgetMiss()
+{
+  static const char* layerNames[e_frame_layer_count] = { "traces", "crumbs", "pins", "lines", "title" };
+
+  char owed[64] = "";
+  for (int l=0; l < e_frame_layer_count; l++)
+  {
+    if (_frameBudget.isOwed(l))
+    {
+      strncat(owed, " ", sizeof(owed) - strlen(owed) - 1);
+      strncat(owed, layerNames[l], sizeof(owed) - strlen(owed) - 1);
+    }
+  }
+
+  USB_SERIAL.printf("FRAME BUDGET: missed, %luus against %dus (%lu of %lu frames missed), put off:%s\n",
+                    _frameBudget.lastFrameUs(), _mapAttr.frameBudgetMicros, _frameBudget.misses(), _frameBudget.frames(),
+                    (owed[0] ? owed : " none"));
+}
+
+bool MapScreen_ex::drawInterpolatedFrame()
+{
+  // only over a base that still matches what would be drawn now; anything else waits for the next fix
+  if (_mapAttr.interpolatedFrameHz <= 0 || !_deadReckoner.hasFix() || _currentMap == nullptr || !_drawnFrame.valid ||
+      _staticOverlaysDirty || !frameToDraw(_lastDiverLatitude, _lastDiverLongitude, _lastDiverHeading).sameSettings(_drawnFrame))
+    return false;
+
+  const uint32_t now = millis();
+  if (now - _lastFrameMs < 1000U / _mapAttr.interpolatedFrameHz)
+    return false;
+
+  const uint32_t t0 = micros();
+  const geo_map& map = *_currentMap;
+
+  double latitude = _lastDiverLatitude, longitude = _lastDiverLongitude, heading = _lastDiverHeading;
+  if (!estimateShownDiver(now, map, latitude, longitude, heading))
+    return false;
+
+  // once the estimate has settled - the diver stopped, or extrapolation ran out - the same pixels would go out again
+  const DrawnFrame frame = frameToDraw(latitude, longitude, heading);
+  if (isFrameUnchanged(frame) || (frame.samePose(_drawnFrame) && !_frameBudget.isAnyOwed()))
+  {
+    _lastFrameMs = now;
+    _framesInterpolationSkipped++;
+    return false;
+  }
+
+  if (!copyBaseToComposite(map))
+    return false;
+
+  _lastFrameMs = now;
+  _headingUpDrawing = (isHeadingUpAvailable() && _headingUpValid);
+  _frameBudget.beginFrame(_mapAttr.frameBudgetMicros > 0 ? _mapAttr.frameBudgetMicros : 0, t0);
+
+  // the dynamic layers, as the full frame draws them and within the same budget
+  uint32_t tLayer = micros();
+  if (_overlayStatic[e_trace_overlay])
+  {
+    _frameBudget.layerCached(e_traces_layer);
+  }
+  else if (_frameBudget.decide(e_traces_layer, tLayer, false) == FrameBudget::e_draw)
+  {
+    drawTracesToSprite(*_compositedScreenSprite, _tileXToDisplay, _tileYToDisplay, map);
+    _frameBudget.layerDrawn(e_traces_layer, micros()-tLayer);
+  }
+
+  if (_recordBreadCrumbTrail)
+    drawRecordIndicator();
+
+  tLayer = micros();
+  if (_overlayStatic[e_breadcrumb_overlay])
+  {
+    _frameBudget.layerCached(e_crumbs_layer);
+  }
+  else
+  {
+    const FrameBudget::decisions crumbs = _frameBudget.decide(e_crumbs_layer, tLayer, true);
+    drawBreadCrumbTrailToSprite(*_compositedScreenSprite, _tileXToDisplay, _tileYToDisplay, map, crumbs == FrameBudget::e_defer);
+    if (crumbs == FrameBudget::e_draw)
+      _frameBudget.layerDrawn(e_crumbs_layer, micros()-tLayer);
+  }
+
+  tLayer = micros();
+  if (_overlayStatic[e_pin_overlay])
+  {
+    _frameBudget.layerCached(e_pins_layer);
+  }
+  else if (_frameBudget.decide(e_pins_layer, tLayer, false) == FrameBudget::e_draw)
+  {
+    drawPlacedPinsToSprite(*_compositedScreenSprite, _tileXToDisplay, _tileYToDisplay, map);
+    _frameBudget.layerDrawn(e_pins_layer, micros()-tLayer);
+  }
+
+  tLayer = micros();
+  if (_frameBudget.decide(e_lines_layer, tLayer, false) == FrameBudget::e_draw)
+  {
+    drawHeadingLineOnCompositeMapSprite(latitude, longitude, heading, map);
+    drawDirectionalLineOnCompositeSprite(latitude, longitude, map, getClosestJettyIndex(_distanceToNearestExit, true), _mapAttr.nearestExitLineColour, _mapAttr.nearestExitLinePixelLength);
+    drawDirectionalLineOnCompositeSprite(latitude, longitude, map, _targetWaypointIndex, _mapAttr.targetLineColour, _mapAttr.targetLinePixelLength);
+    _frameBudget.layerDrawn(e_lines_layer, micros()-tLayer);
+  }
+
+  tLayer = micros();
+  if (_frameBudget.decide(e_title_layer, tLayer, false) == FrameBudget::e_draw)
+  {
+    writeMapTitleToSprite(*_compositedScreenSprite, map);
+    _frameBudget.layerDrawn(e_title_layer, micros()-tLayer);
+  }
+
+  drawDiverOnCompositedMapSprite(latitude, longitude, heading, map);
+  _headingUpDrawing = false;
+  const uint32_t t1 = micros();
+
+  copyFullScreenSpriteToDisplay(*_compositedScreenSprite);
+  const uint32_t t2 = micros();
+  _framesInterpolated++;
+  _drawnFrame = frame;
+
+  // logged once per fix by logInterpolatedFrames, as a serial line per frame would cost more than the frame saves
+  _interpolatedSinceFix++;
+  _interpolatedDrawMicrosSinceFix += t1-t0;
+  _interpolatedDisplayMicrosSinceFix += t2-t1;
+  if (t2-t0 > _interpolatedLongestMicrosSinceFix)
+    _interpolatedLongestMicrosSinceFix = t2-t0;
+
+  if (_frameBudget.endFrame(t2))
+    logFrameBudgetMiss();
+  return true;
+}
+
+bool MapScreen_ex::estimateShownDiver(const uint32_t ms, const geo_map& map, double& latitude, double& longitude, double& heading)
+{
+  SiteFrame::point p;
+  float h;
+  if (_mapAttr.interpolatedFrameHz <= 0 || !_deadReckoner.estimate(ms, p, h))
+    return false;
+
+  double lat, lng;
+  _siteFrame.toGeo(p, lat, lng);
+
+  // drawn only on the tile shown, else it would land at the same place on the wrong tile
+  int16_t tileX = 0, tileY = 0;
+  scalePixelForZoomedInTile(convertGeoToPixelDouble(lat, lng, map), tileX, tileY);
+  if (tileX != _tileXToDisplay || tileY != _tileYToDisplay)
+    return false;
+
+  latitude = lat;
+  longitude = lng;
+  heading = h;
+  return true;
+}
+
+bool MapScreen_ex::copyBaseToComposite(const geo_map& map)
+{
+  // the composite as the last full frame had it before the dynamic layers; none to hand without the base map cache
+  if (isHeadingUpAvailable() && _headingUpValid)
+    _headingUpSprite->pushToSprite(*_compositedScreenSprite, 0, 0);
+  else if (_panning)
+    composePanningBase(map);
+  else if (useBaseMapCache())
+    _baseMapCacheSprite->pushToSprite(*_compositedScreenSprite, 0, 0);
+  else
+    return false;
+
+  return true;
+}
+
+void MapScreen_ex::composePanningBase(const geo_map& map)
+{
+  // unroll the ring, then what would have been baked with the tile
+  _panViewport.copyTo((uint16_t*)_compositedScreenSprite->getPointer());
+
+  if (_drawAllFeatures)
+    drawFeaturesOnBaseMapSprite(map, *_compositedScreenSprite);
+
+  drawMapScaleToSprite(*_compositedScreenSprite, map);
+  drawStaticOverlaysToSprite(*_compositedScreenSprite, _tileXToDisplay, _tileYToDisplay, map);
+}
+
+MapScreen_ex::DrawnFrame MapScreen_ex::frameToDraw(const double diverLatitude, const double diverLongitude, const double diverHeading)
+{
+  DrawnFrame frame;
+  ensureWaypointIndices();
+  frame.valid = true;
+  frame.position = _siteFrame.toLocal(diverLatitude, diverLongitude);
+  frame.heading = diverHeading;
+  frame.zoomFixed = zoomFixed();
+  frame.allLake = _showAllLake;
+  frame.drawAllFeatures = _drawAllFeatures;
+  frame.headingUp = _headingUp;
+  frame.useDiverHeading = _useDiverHeading;
+  frame.showBreadCrumbTrail = _showBreadCrumbTrail;
+  frame.targetWaypointIndex = _targetWaypointIndex;
+  frame.prevWaypointIndex = _prevWaypointIndex;
+  frame.overlayChanges = _overlayChanges;
+  return frame;
+}
+
+bool MapScreen_ex::isFrameUnchanged(const DrawnFrame& frame) const
+{
+  // recording blinks its light each fix, so keeps drawing; a layer the frame budget put off is drawn at the next fix
+  if (_mapAttr.frameSkipMetres <= 0 || !frame.valid || !_drawnFrame.valid || _currentMap == nullptr || _staticOverlaysDirty || _recordBreadCrumbTrail ||
+      isMapDecoding() || _frameBudget.isAnyOwed() || !frame.sameSettings(_drawnFrame))
+    return false;
+
+  const float degrees = (_mapAttr.frameSkipDegrees > 0 ? _mapAttr.frameSkipDegrees : _defaultFrameSkipDegrees);
+  return hypot(frame.position.e - _drawnFrame.position.e, frame.position.n - _drawnFrame.position.n) < _mapAttr.frameSkipMetres &&
+         fabs(fmod(frame.heading - _drawnFrame.heading + 540.0, 360.0) - 180.0) < degrees;
+}
+
+bool MapScreen_ex::composeBaseTile(const geo_map& map, TFT_eSprite& sprite)
+{
+  // map image, features and scale bar for _zoom and the tile to display; false if the image couldn't be loaded
+  bool composed = false;
+
+  if (showsThumbnail(map))
+  {
+    // not composed: the full image replaces it once decoded, so it's never cached
+    const uint32_t tScaleStart = micros();
+    const int32_t originX = (int32_t)getTFTWidth() * _tileXToDisplay;
+    const int32_t originY = (int32_t)getTFTHeight() * _tileYToDisplay;
+    sprite.fillSprite(map.backColour);
+    _thumbnail.scaleRect((uint16_t*)sprite.getPointer(), _zoomScale.fixed(), originX, originY, getTFTWidth(), getTFTHeight(), map.swapBytes);
+
+    if (_drawAllFeatures)
+    {
+      drawFeaturesOnBaseMapSprite(map, sprite);
+    }
+
+    drawMapScaleToSprite(sprite, map);
+    USB_SERIAL.printf("  TIMING: thumbnail load=%luus scale=%luus\n", _thumbnail.loadMicros(), micros()-tScaleStart);
+  }
+  else if (useBaseMapCache() && map.png)
+  {
+    USB_SERIAL.printf("  → Loading PNG: %s\n", map.png);
+    const uint32_t tPngStart = micros();
+    const uint16_t* pngPixels = drawPNG(map.png, map.swapBytes);
+    const uint32_t tPngEnd = micros();
+
+    if (pngPixels)
+    {
+      const uint32_t tScaleStart = micros();
+      scaleMapImageToSprite(sprite, pngPixels, map);
+      const uint32_t tScaleEnd = micros();
+
+      if (_drawAllFeatures)
+      {
+        drawFeaturesOnBaseMapSprite(map, sprite);
+      }
+
+      drawMapScaleToSprite(sprite, map);
+      composed = isPngDecoded(map.png);     // not the placeholder colour of a failed decode
+      USB_SERIAL.printf("  TIMING: drawPNG=%luus pushImageScaled=%luus\n", tPngEnd-tPngStart, tScaleEnd-tScaleStart);
+    }
+    else
+    {
+      sprite.fillSprite(map.backColour);
+      drawFeaturesOnBaseMapSprite(map, sprite);
+    }
+  }
+  else if (map.mapData)
+  {
+    // Flash-based map data (fallback when PNG not available or cache disabled)
+    const uint32_t tScaleStart = micros();
+    scaleMapImageToSprite(sprite, map.mapData, map);
+    const uint32_t tScaleEnd = micros();
+
+    if (_drawAllFeatures)
+    {
+      drawFeaturesOnBaseMapSprite(map, sprite);
+    }
+
+    drawMapScaleToSprite(sprite, map);
+    composed = true;
+    USB_SERIAL.printf("  TIMING: pushImageScaled(mapData)=%luus\n", tScaleEnd-tScaleStart);
+  }
+  else
+  {
+    sprite.fillSprite(map.backColour);
+    drawFeaturesOnBaseMapSprite(map, sprite);
+  }
+
+  return composed;
+}
+
+void MapScreen_ex::scaleMapImageToSprite(TFT_eSprite& sprite, const uint16_t* pixels, const geo_map& map)
+{
+  if (_zoomScale.isInteger())
+  {
+    sprite.pushImageScaled(0, 0, getTFTWidth(), getTFTHeight(), _zoom, _tileXToDisplay, _tileYToDisplay,
+                           pixels, map.swapBytes);
+    return;
+  }
+
+  // the last tile across or down runs off the edge of the map
+  const int32_t originX = (int32_t)getTFTWidth() * _tileXToDisplay;
+  const int32_t originY = (int32_t)getTFTHeight() * _tileYToDisplay;
+  if (originX + getTFTWidth() > _zoomScale.zoomedWidth() || originY + getTFTHeight() > _zoomScale.zoomedHeight())
+    sprite.fillSprite(map.backColour);
+
+  _zoomScale.scaleRect((uint16_t*)sprite.getPointer(), pixels, originX, originY, getTFTWidth(), getTFTHeight(), map.swapBytes);
+}
+
+const uint16_t* MapScreen_ex::panSourcePixels(const geo_map& map)
+{
+  if (!map.png)
+    return map.mapData;
+
+  // the decode is normally still in a buffer from the zoom 1 view, so don't go through drawPNG's logging each frame
+  const uint16_t* pixels = decodedPngPixels(map.png);
+  if (pixels == nullptr && isPngDecodingSliced(map.png))
+    return nullptr;      // fixed tiles until it's whole, rather than waiting on it
+  if (pixels == nullptr)
+  {
+    drawPNG(map.png, map.swapBytes);
+    pixels = decodedPngPixels(map.png);
+  }
+  return pixels;
+}
+
+void MapScreen_ex::prerenderZoomCycle()
+{
+  // a decode in slices would have to finish first, blocking the idle call
+  if (!_composedTiles.isEnabled() || !_prerenderSprite->created() || _currentMap == nullptr || isMapDecoding() ||
+      (_lastDiverLatitude == 0 && _lastDiverLongitude == 0))
+    return;
+
+  // where the next cycleZoom lands, as cycleZoom steps: detail 1 -> 2 -> 3 -> 4 -> all lake -> detail 1
+  const geo_map* allLakeMap = _maps + getAllMapIndex();
+  const geo_map* nextMap = (_showAllLake ? _lastDetailMap : _zoom == 4 ? allLakeMap : _currentMap);
+  const int16_t nextZoom = (_showAllLake || _zoom == 4 ? 1 : _zoom + 1);
+
+  // at most one tile per call, as composing it may mean a PNG decode; zoomed views that pan aren't tiles
+  const bool nextPans = (_mapAttr.panDeadbandPixels > 0 && nextZoom > 1);
+  if (nextMap == nullptr || nextPans || !prerenderTile(*nextMap, nextZoom, nextMap == allLakeMap))
+    prerenderTile(*allLakeMap, 1, true);
+}
+
+bool MapScreen_ex::prerenderTile(const geo_map& map, const int16_t zoom, const bool allLake)
+{
+  const int16_t zoomShown = _zoom;
+  const int16_t tileXShown = _tileXToDisplay;
+  const int16_t tileYShown = _tileYToDisplay;
+  const bool allLakeShown = _showAllLake;
+  const bool panning = _panning;
+  const uint32_t fractionalZoom = _fractionalZoom;
+
+  // compose as that view would, on the tile the diver is in
+  _zoom = zoom;
+  _fractionalZoom = 0;
+  _zoomScale.set(zoomFixed(), getTFTWidth(), getTFTHeight());
+  _showAllLake = allLake;
+  _panning = false;
+  scalePixelForZoomedInTile(convertGeoToPixelDouble(_lastDiverLatitude, _lastDiverLongitude, map), _tileXToDisplay, _tileYToDisplay);
+
+  const ComposedTileCache::Key key = { &map, _zoomScale.fixed(), _tileXToDisplay, _tileYToDisplay, _drawAllFeatures };
+  const bool attempt = !_composedTiles.contains(key) && !(key == _prerenderFailedKey);
+  if (attempt)
+  {
+    const uint32_t tStart = micros();
+    if (composeBaseTile(map, *_prerenderSprite))
+      _composedTiles.store(key, _prerenderSprite->getPointer());
+    else
+      _prerenderFailedKey = key;      // don't retry a missing or broken PNG every idle call
+
+    USB_SERIAL.printf("prerenderTile: '%s' zoom %d tile %d,%d in %luus\n", map.label, _zoom, _tileXToDisplay, _tileYToDisplay, micros()-tStart);
+  }
+
+  _zoom = zoomShown;
+  _tileXToDisplay = tileXShown;
+  _tileYToDisplay = tileYShown;
+  _showAllLake = allLakeShown;
+  _panning = panning;
+  _fractionalZoom = fractionalZoom;
+  _zoomScale.set(zoomFixed(), getTFTWidth(), getTFTHeight());
+  return attempt;
 }
 
 bool MapScreen_ex::isPixelOutsideScreenExtent(const MapScreen_ex::pixel loc) const
@@ -726,6 +1930,32 @@ bool MapScreen_ex::isPixelOutsideScreenExtent(const MapScreen_ex::pixel loc) con
 
 MapScreen_ex::pixel MapScreen_ex::scalePixelForZoomedInTile(const pixel p, int16_t& tileX, int16_t& tileY) const
 {
+  if (_panning)
+  {
+    // tile 0,0 is the viewport, so anything on screen is on the diver's tile and the rest is a screen or more away
+    const int32_t x = _zoomScale.zoomed(p.x) - _panViewport.originX();
+    const int32_t y = _zoomScale.zoomed(p.y) - _panViewport.originY();
+    tileX = (x >= 0 ? x / getTFTWidth() : -1 - (-x - 1) / getTFTWidth());
+    tileY = (y >= 0 ? y / getTFTHeight() : -1 - (-y - 1) / getTFTHeight());
+
+    return pixel(x - getTFTWidth() * tileX, y - getTFTHeight() * tileY, p.colour);
+  }
+
+  if (_fractionalZoom)
+  {
+    // _zoom tiles across, the last partly off the map
+    const int32_t x = _zoomScale.zoomed(p.x);
+    const int32_t y = _zoomScale.zoomed(p.y);
+    tileX = x / getTFTWidth();
+    tileY = y / getTFTHeight();
+
+    if (tileX < _zoom && tileY < _zoom)
+      return pixel(x - getTFTWidth() * tileX, y - getTFTHeight() * tileY, p.colour);
+
+    tileX = tileY = 0;
+    return pixel(x, y, p.colour);
+  }
+
   tileX = p.x / (getTFTWidth() / _zoom);
   tileY = p.y / (getTFTHeight() / _zoom);
 
@@ -802,6 +2032,22 @@ double MapScreen_ex::radiansCourseTo(double lat1, double long1, double lat2, dou
   return a2;
 }
 
+float MapScreen_ex::siteDistanceToWaypoint(const double lat, const double lng, const int waypointIndex) const
+{
+  if (waypointIndex < _featureGridFirstIndex || waypointIndex >= _featureGridEndIndex)
+    return distanceBetween(lat, lng, WraysburyWaypoints::waypoints[waypointIndex]._lat, WraysburyWaypoints::waypoints[waypointIndex]._long);
+
+  return SiteFrame::distance(_siteFrame.toLocal(lat, lng), _waypointLocal[waypointIndex - _featureGridFirstIndex]);
+}
+
+float MapScreen_ex::siteDegreesCourseToWaypoint(const double lat, const double lng, const int waypointIndex) const
+{
+  if (waypointIndex < _featureGridFirstIndex || waypointIndex >= _featureGridEndIndex)
+    return degreesCourseTo(lat, lng, WraysburyWaypoints::waypoints[waypointIndex]._lat, WraysburyWaypoints::waypoints[waypointIndex]._long);
+
+  return SiteFrame::degreesCourse(_siteFrame.toLocal(lat, lng), _waypointLocal[waypointIndex - _featureGridFirstIndex]);
+}
+
 int MapScreen_ex::drawDirectionalLineOnCompositeSprite(const double diverLatitude, const double diverLongitude, 
                                                   const geo_map& featureMap, const int waypointIndex, uint16_t colour, int indicatorLength)
 {
@@ -827,16 +2073,18 @@ int MapScreen_ex::drawDirectionalLineOnCompositeSprite(const double diverLatitud
   {
   //sprintf(_debugString,"6"); fillScreen(TFT_GREEN); delay(1000);
     // use line between diver and target locations
-    pTarget.x = pTarget.x * _zoom - getTFTWidth() * diverTileX;
-    pTarget.y = pTarget.y * _zoom - getTFTHeight() * diverTileY;
+    pTarget.x = _zoomScale.zoomed(pTarget.x) - tileOriginX(diverTileX);
+    pTarget.y = _zoomScale.zoomed(pTarget.y) - tileOriginY(diverTileY);
 
   //sprintf(_debugString,"7"); fillScreen(TFT_GREEN); delay(1000);
-    _compositedScreenSprite->drawLine(pDiver.x, pDiver.y, pTarget.x,pTarget.y,colour);
+    const pixel lineStart = toHeadingUp(pDiver);
+    const pixel lineEnd = toHeadingUp(pTarget);
+    _compositedScreenSprite->drawLine(lineStart.x, lineStart.y, lineEnd.x,lineEnd.y,colour);
 
-    _compositedScreenSprite->drawLine(pDiver.x-2, pDiver.y-2, pTarget.x,pTarget.y,colour);
-    _compositedScreenSprite->drawLine(pDiver.x-2, pDiver.y+2, pTarget.x,pTarget.y,colour);
-    _compositedScreenSprite->drawLine(pDiver.x+2, pDiver.y-2, pTarget.x,pTarget.y,colour);
-    _compositedScreenSprite->drawLine(pDiver.x+2, pDiver.y+2, pTarget.x,pTarget.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x-2, lineStart.y-2, lineEnd.x,lineEnd.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x-2, lineStart.y+2, lineEnd.x,lineEnd.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x+2, lineStart.y-2, lineEnd.x,lineEnd.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x+2, lineStart.y+2, lineEnd.x,lineEnd.y,colour);
 
   //sprintf(_debugString,"8"); fillScreen(TFT_GREEN); delay(1000);
     if (pTarget.y < pDiver.y)
@@ -848,23 +2096,24 @@ int MapScreen_ex::drawDirectionalLineOnCompositeSprite(const double diverLatitud
   else
   {
   //sprintf(_debugString,"10"); fillScreen(TFT_GREEN); delay(1000);
-    heading = degreesCourseTo(diverLatitude,diverLongitude,w._lat,w._long);
+    heading = siteDegreesCourseToWaypoint(diverLatitude,diverLongitude,waypointIndex);
 
     // use lat/long to draw outside map area with arbitrary length.
     pixel pHeading;
   
   //sprintf(_debugString,"11"); fillScreen(TFT_GREEN); delay(1000);
-    double rads = heading * PI / 180.0;  
-    pHeading.x = pDiver.x + indicatorLength * sin(rads);
-    pHeading.y = pDiver.y - indicatorLength * cos(rads);
+    const pixel lineStart = toHeadingUp(pDiver);
+    double rads = headingOnScreen(heading) * PI / 180.0;  
+    pHeading.x = lineStart.x + indicatorLength * sin(rads);
+    pHeading.y = lineStart.y - indicatorLength * cos(rads);
 
   //sprintf(_debugString,"12"); fillScreen(TFT_GREEN); delay(1000);
-    _compositedScreenSprite->drawLine(pDiver.x, pDiver.y, pHeading.x,pHeading.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x, lineStart.y, pHeading.x,pHeading.y,colour);
   
-    _compositedScreenSprite->drawLine(pDiver.x-2, pDiver.y-2, pHeading.x,pHeading.y,colour);
-    _compositedScreenSprite->drawLine(pDiver.x-2, pDiver.y+2, pHeading.x,pHeading.y,colour);
-    _compositedScreenSprite->drawLine(pDiver.x+2, pDiver.y-2, pHeading.x,pHeading.y,colour);
-    _compositedScreenSprite->drawLine(pDiver.x+2, pDiver.y+2, pHeading.x,pHeading.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x-2, lineStart.y-2, pHeading.x,pHeading.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x-2, lineStart.y+2, pHeading.x,pHeading.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x+2, lineStart.y-2, pHeading.x,pHeading.y,colour);
+    _compositedScreenSprite->drawLine(lineStart.x+2, lineStart.y+2, pHeading.x,pHeading.y,colour);
   //sprintf(_debugString,"13"); fillScreen(TFT_GREEN); delay(1000);
   }
   //sprintf(_debugString,"14"); fillScreen(TFT_GREEN); delay(1000);
@@ -875,6 +2124,7 @@ int MapScreen_ex::drawDirectionalLineOnCompositeSprite(const double diverLatitud
 void MapScreen_ex::toggleShowBreadCrumbTrail()
 {
   _showBreadCrumbTrail = !_showBreadCrumbTrail;
+  invalidateOverlay(e_breadcrumb_overlay);
 
   if (!_showBreadCrumbTrail && _recordBreadCrumbTrail)
     toggleRecordBreadCrumbTrail();
@@ -904,15 +2154,131 @@ void MapScreen_ex::setBreadCrumbTrailRecord(const bool enable)
 
 void MapScreen_ex::clearBreadCrumbTrail()
 {
-  _nextCrumbIndex = 0;
+  _breadCrumbExporter.cancel();
+  _breadCrumbTrail.clear();
+  _breadCrumbPolylineMap = nullptr;
+  _breadCrumbPolylineThinned = 0;
+  invalidateOverlay(e_breadcrumb_overlay);
+  if (!_breadCrumbJournal.rotate())
+    USB_SERIAL.println("clearBreadCrumbTrail: journal rotate FAILED");
   _breadCrumbCountDown = _mapAttr.breadCrumbDropFixCount;
   _recordBreadCrumbTrail = true; // force toggle to disable recordbreadcrumb and publish message to mako regardless.
   toggleRecordBreadCrumbTrail();
 }
 
+bool MapScreen_ex::isBreadCrumbDropDue(const double diverLatitude, const double diverLongitude)
+{
+  if (_mapAttr.breadCrumbDropMinDistance <= 0 || !_siteFrame.isSet())
+    return _breadCrumbCountDown == 0;
+
+  if (_breadCrumbTrail.size() == 0)
+    return true;
+
+  return SiteFrame::distance(_lastBreadCrumbLocal, _siteFrame.toLocal(diverLatitude, diverLongitude)) >= _mapAttr.breadCrumbDropMinDistance;
+}
+
+void MapScreen_ex::thinBreadCrumbTrail()
+{
+  const uint32_t now = millis();
+
+  // an export reads the log's segments in place, so they must not move under it - but one nobody reads any more
+  // would hold thinning off until the log filled and recording stopped, so it is cancelled once it stalls
+  if (_breadCrumbExporter.isActive())
+  {
+    if (_breadCrumbExporter.bytesExported() != _breadCrumbExportBytesSeen)
+    {
+      _breadCrumbExportBytesSeen = _breadCrumbExporter.bytesExported();
+      _breadCrumbExportProgressMs = now;
+    }
+    if (now - _breadCrumbExportProgressMs < _breadCrumbExportStallMs)
+      return;
+
+    USB_SERIAL.printf("thinBreadCrumbTrail: export stalled at %lu bytes for %lums, cancelled\n", _breadCrumbExportBytesSeen, now - _breadCrumbExportProgressMs);
+    _breadCrumbExporter.cancel();
+  }
+  _breadCrumbExportBytesSeen = 0;
+  _breadCrumbExportProgressMs = now;
+
+  // at most one or two segments rewritten per frame
+  const uint32_t passes = _breadCrumbTrail.thinningPasses();
+  const uint32_t tStart = micros();
+
+  if (!_breadCrumbTrail.thinStep(_siteFrame) || _breadCrumbTrail.thinningPasses() == passes)
+    return;
+
+  invalidateOverlay(e_breadcrumb_overlay);
+
+  USB_SERIAL.printf("thinBreadCrumbTrail: pass %lu done, %d crumbs in %lu of %lu bytes, %lu thinned, last step %luus\n",
+                    _breadCrumbTrail.thinningPasses(), _breadCrumbTrail.size(), _breadCrumbTrail.usedBytes(),
+                    _breadCrumbTrail.budgetBytes(), _breadCrumbTrail.thinnedCrumbs(), micros()-tStart);
+}
+
+void MapScreen_ex::updateBreadCrumbPolyline(const geo_map& featureMap)
+{
+  // thinning only removes crumbs well before the newest, so normally those already folded in - shift the count to match
+  const uint32_t thinned = _breadCrumbTrail.thinnedCrumbs() - _breadCrumbPolylineThinned;
+  const bool thinnedUnfolded = (thinned > 0 && _breadCrumbTrail.size() + (int)thinned - _breadCrumbPolylineCrumbs > _breadCrumbFullResolutionCount);
+  _breadCrumbPolylineCrumbs -= thinned;
+  _breadCrumbPolylineThinned = _breadCrumbTrail.thinnedCrumbs();
+
+  if (&featureMap != _breadCrumbPolylineMap || _zoomScale.fixed() != _breadCrumbPolylineZoom || thinnedUnfolded ||
+      _breadCrumbPolylineCrumbs < 0 || _breadCrumbPolylineCrumbs > _breadCrumbTrail.size())
+  {
+    _breadCrumbPolyline.clear(_breadCrumbPolylineSpacing);
+    _breadCrumbPolylineMap = &featureMap;
+    _breadCrumbPolylineZoom = _zoomScale.fixed();
+    _breadCrumbPolylineCrumbs = 0;
+  }
+
+  CrumbLog::Iterator it = _breadCrumbTrail.from(_breadCrumbPolylineCrumbs);
+  CrumbLog::Crumb crumb;
+  while (it.next(crumb))
+  {
+    const pixel p = convertGeoToPixelDouble(crumb.lat(), crumb.lng(), featureMap);
+    _breadCrumbPolyline.add(_zoomScale.zoomed(p.x), _zoomScale.zoomed(p.y));
+  }
+  _breadCrumbPolylineCrumbs = _breadCrumbTrail.size();
+}
+
+void MapScreen_ex::beginBreadCrumbExport(const CrumbExporter::Format format)
+{
+  _breadCrumbExporter.begin(_breadCrumbTrail, format);
+}
+
+size_t MapScreen_ex::readBreadCrumbExport(uint8_t* chunk, const size_t capacity)
+{
+  const bool wasActive = _breadCrumbExporter.isActive();
+  const size_t n = _breadCrumbExporter.read(chunk, capacity);
+
+  if (wasActive && !_breadCrumbExporter.isActive())
+    USB_SERIAL.printf("readBreadCrumbExport: done, %lu crumbs in %lu bytes\n", _breadCrumbExporter.crumbsExported(), _breadCrumbExporter.bytesExported());
+
+  return n;
+}
+
 void MapScreen_ex::placePin(const double lat, const double lng, const double head, const double dep)
 {
-  _placedPins[_placedPinIndex++] = BreadCrumb(lat,lng,head,dep);
+  const uint32_t now = millis();
+  if (_placedPins.push(lat,lng,head,dep,now))
+  {
+    _placedPinTimesMs.push_back(now);
+
+    // the pool now holds the new pin, so a compacted journal has it too
+    if (!_pinJournal.append(CrumbLog::Crumb::fromDegrees(lat,lng,head,dep,now), now))
+      compactPinJournal();
+    invalidateOverlay(e_pin_overlay);
+  }
+  else
+    USB_SERIAL.printf("placePin: pin store full (%d pins), clearPlacedPins to reuse\n", _placedPins.capacity());
+}
+
+void MapScreen_ex::clearPlacedPins()
+{
+  _placedPins.clear();
+  _placedPinTimesMs.clear();
+  invalidateOverlay(e_pin_overlay);
+  if (!_pinJournal.clear())
+    USB_SERIAL.println("clearPlacedPins: journal clear FAILED");
 }
 
 void MapScreen_ex::drawPlacedPins(const double diverLatitude, const double diverLongitude, const geo_map& featureMap)
@@ -921,114 +2287,266 @@ void MapScreen_ex::drawPlacedPins(const double diverLatitude, const double diver
   pixel diverLocation = convertGeoToPixelDouble(diverLatitude, diverLongitude, featureMap);
   diverLocation = scalePixelForZoomedInTile(diverLocation,diverTileX,diverTileY);
 
-  // draw the entire array of pins to composite sprite within map view
-  for (int i=0; i < _placedPinIndex; i++)
+  drawPlacedPinsToSprite(*_compositedScreenSprite, diverTileX, diverTileY, featureMap);
+}
+
+void MapScreen_ex::drawPlacedPinsToSprite(TFT_eSprite& sprite, const int16_t tileX, const int16_t tileY, const geo_map& featureMap)
+{
+  // draw the entire array of pins to the sprite within map view
+  for (int i=0; i < _placedPins.size(); i++)
   {
-    pixel pinLocation = convertGeoToPixelDouble(_placedPins[i]._lat, _placedPins[i]._long, featureMap);
+    const BreadCrumb pin = getPlacedPin(i);
+    pixel pinLocation = convertGeoToPixelDouble(pin._lat, pin._long, featureMap);
     if (isPixelOutsideScreenExtent(pinLocation))
       continue;
 
     int16_t pinTileX=0,pinTileY=0;
     pinLocation = scalePixelForZoomedInTile(pinLocation,pinTileX,pinTileY);
 
-    if (pinTileX != diverTileX || pinTileY != diverTileY)
+    if (pinTileX != tileX || pinTileY != tileY)
       continue;
 
-    _pinSprite->pushToSprite(*_compositedScreenSprite,pinLocation.x-_mapAttr.pinWidth/2,pinLocation.y-_mapAttr.pinWidth/2,TFT_BLACK); // BLACK is the transparent colour
+    pinLocation = toHeadingUp(pinLocation);
+    _pinSprite->pushToSprite(sprite,pinLocation.x-_mapAttr.pinWidth/2,pinLocation.y-_mapAttr.pinWidth/2,TFT_BLACK); // BLACK is the transparent colour
   }
 }
 
-void MapScreen_ex::drawTracesOnCompositeMapSprite(const double diverLatitude, const double diverLongitude, const geo_map& featureMap)
+TraceLod& MapScreen_ex::buildTraceLayerLod(TraceLayer& layer, const int slot, const geo_map& featureMap)
 {
-  // Rebuild pixel cache when map changes — convertGeoToPixelDouble is expensive at 1381 points/frame
-  if (&featureMap != tracePixelCacheMap)
+  const uint32_t tStart = micros();
+  const bool simplify = (_mapAttr.traceSimplifyMetres > 0);
+  if (simplify)
+    ensureWaypointIndices();
+
+  // one pass over the source: map pixels to draw, and site metres to simplify in
+  std::vector<float> mapX, mapY, east, north;
+  mapX.reserve(layer.pointCount());
+  mapY.reserve(layer.pointCount());
+  layer.forEachPoint([&](const double lat, const double lng)
   {
-    const int n = WraysburyTraces::getAllTraceCount();
-    tracePixelCache.resize(n);
+    double x, y;
+    convertGeoToFractionalPixel(lat, lng, featureMap, x, y);
+    mapX.push_back(x);
+    mapY.push_back(y);
+
+    if (simplify)
+    {
+      const SiteFrame::point p = _siteFrame.toLocal(lat, lng);
+      east.push_back(p.e);
+      north.push_back(p.n);
+    }
+  });
+
+  const int n = mapX.size();
+  if (simplify && n > 2)
+  {
+    std::unique_ptr<bool[]> keep(new bool[n]);
+    std::unique_ptr<int32_t[][2]> stack(new int32_t[n][2]);
+    douglasPeucker(east.data(), north.data(), n, _mapAttr.traceSimplifyMetres, keep.get(), stack.get());
+
+    int kept = 0;
     for (int i = 0; i < n; i++)
-      tracePixelCache[i] = convertGeoToPixelDouble(WraysburyTraces::all_trace[i]._la, WraysburyTraces::all_trace[i]._lo, featureMap);
-    tracePixelCacheMap = &featureMap;
-    USB_SERIAL.printf("drawTracesOnCompositeMapSprite: rebuilt pixel cache for map '%s' (%d points)\n", featureMap.label, n);
+    {
+      if (!keep[i])
+        continue;
+      mapX[kept] = mapX[i];
+      mapY[kept] = mapY[i];
+      kept++;
+    }
+    mapX.resize(kept);
+    mapY.resize(kept);
   }
 
+  // points within half a marker of each other draw as one
+  TraceLod& lod = layer.resetLod(slot, &featureMap);
+  lod.setMapPoints(mapX, mapY, getTFTWidth(), getTFTHeight(), std::max(_mapAttr.tracePointSize / 2, 1));
+  USB_SERIAL.printf("drawTracesOnCompositeMapSprite: rebuilt layer '%s' LOD for map '%s' (%d of %d points) in %luus\n",
+                    layer.name(), featureMap.label, lod.sourcePointCount(), n, micros()-tStart);
+  return lod;
+}
+
+void MapScreen_ex::drawTracesOnCompositeMapSprite(const double diverLatitude, const double diverLongitude, const geo_map& featureMap)
+{
   int16_t diverTileX=0,diverTileY=0;
   pixel diverLocation = convertGeoToPixelDouble(diverLatitude, diverLongitude, featureMap);
   diverLocation = scalePixelForZoomedInTile(diverLocation,diverTileX,diverTileY);
 
-  const int n = WraysburyTraces::getAllTraceCount();
-  for (int i = 0; i < n; i++)
-  {
-    pixel pointLocation = tracePixelCache[i];
-    if (isPixelOutsideScreenExtent(pointLocation))
-      continue;
+  drawTracesToSprite(*_compositedScreenSprite, diverTileX, diverTileY, featureMap);
+}
 
-    int16_t pointTileX=0,pointTileY=0;
-    pointLocation = scalePixelForZoomedInTile(pointLocation,pointTileX,pointTileY);
+void MapScreen_ex::drawTracesToSprite(TFT_eSprite& sprite, const int16_t tileX, const int16_t tileY, const geo_map& featureMap)
+{
+  const int slot = (_showAllLake ? 1 : 0);
 
-    if (pointTileX != diverTileX || pointTileY != diverTileY)
+  for (size_t l = 0; l < _traceLayers.size(); l++)
+  {
+    TraceLayer& layer = _traceLayers[l];
+    if (!layer.visible)
       continue;
 
-    _compositedScreenSprite->drawRect(pointLocation.x-1,pointLocation.y-1,_mapAttr.tracePointSize,_mapAttr.tracePointSize,_mapAttr.traceColour);
+    // rebuilt only when this layer's map changes — convertGeoToPixelDouble is expensive at thousands of points/frame
+    TraceLod* lod = layer.cachedLod(slot, &featureMap);
+    if (lod == nullptr)
+      lod = &buildTraceLayerLod(layer, slot, featureMap);
+
+    // the map tiles under the view: just the one with fixed tiles, up to four while panning
+    const int32_t originX = tileOriginX(tileX);
+    const int32_t originY = tileOriginY(tileY);
+    for (int32_t ty = originY / getTFTHeight(); ty * getTFTHeight() < originY + getTFTHeight(); ty++)
+    {
+      for (int32_t tx = originX / getTFTWidth(); tx * getTFTWidth() < originX + getTFTWidth(); tx++)
+      {
+        const TraceLod::Point* points = nullptr;
+        int count = 0;
+        if (!lod->tilePoints(_zoomScale.fixed(), tx, ty, points, count))
+          continue;
+
+        const int16_t dx = tx * getTFTWidth() - originX;
+        const int16_t dy = ty * getTFTHeight() - originY;
+        for (int i = 0; i < count; i++)
+        {
+          const pixel p = toHeadingUp(pixel(points[i].x+dx, points[i].y+dy, layer.colour));
+          sprite.drawRect(p.x-1,p.y-1,_mapAttr.tracePointSize,_mapAttr.tracePointSize,layer.colour);
+        }
+      }
+    }
   }
 }
 
 void MapScreen_ex::drawBreadCrumbTrailOnCompositeMapSprite(const double diverLatitude, const double diverLongitude, 
                                                             const double heading, const geo_map& featureMap)
+{
+  recordBreadCrumbTrail(diverLatitude, diverLongitude, heading);
+
+  int16_t diverTileX=0,diverTileY=0;
+  pixel diverLocation = convertGeoToPixelDouble(diverLatitude, diverLongitude, featureMap);
+  diverLocation = scalePixelForZoomedInTile(diverLocation,diverTileX,diverTileY);
+
+  drawBreadCrumbTrailToSprite(*_compositedScreenSprite, diverTileX, diverTileY, featureMap);
+}
+
+void MapScreen_ex::drawRecordIndicator()
+{
+  if (_breadCrumbCountDown % 2)        // blink the record light
+  {
+    const int recordIndicatorWidth = 30;
+    _compositedScreenSprite->fillRect(0,getTFTHeight()-recordIndicatorWidth-1,recordIndicatorWidth,recordIndicatorWidth,TFT_RED);
+  }
+}
+
+void MapScreen_ex::recordBreadCrumbTrail(const double diverLatitude, const double diverLongitude, const double heading)
 {
   if (_recordBreadCrumbTrail)
   {
     _breadCrumbCountDown--;
 
-    if (_nextCrumbIndex < _maxBreadCrumbs && _breadCrumbCountDown == 0)
+    if (!_breadCrumbTrail.full() && isBreadCrumbDropDue(diverLatitude, diverLongitude))
     {
-      _breadCrumbTrail[_nextCrumbIndex++] = BreadCrumb(diverLatitude, diverLongitude, heading);
-      _breadCrumbCountDown = _mapAttr.breadCrumbDropFixCount;
+      const CrumbLog::Crumb crumb = CrumbLog::Crumb::fromDegrees(diverLatitude, diverLongitude, heading, 0.0, millis());
+      if (_breadCrumbTrail.append(crumb))
+      {
+        _lastBreadCrumbLocal = _siteFrame.toLocal(diverLatitude, diverLongitude);
+        _breadCrumbJournal.append(crumb, millis());   // RAM only, written by serviceIdle()
+        invalidateOverlay(e_breadcrumb_overlay);
+      }
+      else
+        USB_SERIAL.printf("recordBreadCrumbTrail: crumb log full (%d crumbs, %lu bytes)\n", _breadCrumbTrail.size(), _breadCrumbTrail.usedBytes());
     }
 
-    if (_breadCrumbCountDown % 2)        // blink the record light
-    {
-      const int recordIndicatorWidth = 30;
-      _compositedScreenSprite->fillRect(0,getTFTHeight()-recordIndicatorWidth-1,recordIndicatorWidth,recordIndicatorWidth,TFT_RED);
-    }
+    if (_breadCrumbCountDown == 0)
+      _breadCrumbCountDown = _mapAttr.breadCrumbDropFixCount;
+
+    drawRecordIndicator();
   }
 
-  if (_showBreadCrumbTrail)
+  // before drawing, as thinning invalidates the log iterator
+  thinBreadCrumbTrail();
+}
+
+void MapScreen_ex::drawBreadCrumbTrailToSprite(TFT_eSprite& sprite, const int16_t tileX, const int16_t tileY, const geo_map& featureMap,
+                                               const bool newestOnly)
+{
+  if (!_showBreadCrumbTrail)
+    return;
+
+  if (_mapAttr.breadCrumbStyle == e_breadcrumb_polyline)
   {
-    int16_t diverTileX=0,diverTileY=0;
-    pixel diverLocation = convertGeoToPixelDouble(diverLatitude, diverLongitude, featureMap);
-    diverLocation = scalePixelForZoomedInTile(diverLocation,diverTileX,diverTileY);
+    updateBreadCrumbPolyline(featureMap);
 
-  // draw the entire array of pins to composite sprite within map view
-    for (int i=0; i < _nextCrumbIndex; i++)
-    {
-      pixel crumbLocation = convertGeoToPixelDouble(_breadCrumbTrail[i]._lat, _breadCrumbTrail[i]._long, featureMap);
-      if (isPixelOutsideScreenExtent(crumbLocation))
-        continue;
+    const int arrowSpacing = (_mapAttr.breadCrumbArrowSpacing > 0 ? _mapAttr.breadCrumbArrowSpacing : _defaultBreadCrumbArrowSpacing);
+    _breadCrumbPolyline.draw(sprite, tileOriginX(tileX), tileOriginY(tileY),
+                             getTFTWidth(), getTFTHeight(), _mapAttr.breadCrumbColour, arrowSpacing, _breadCrumbArrowLength,
+                             (_headingUpDrawing ? &_headingUpBlit : nullptr), (newestOnly ? _deferredBreadCrumbRuns : 0));
+    return;
+  }
 
-      int16_t crumbTileX=0,crumbTileY=0;
-      crumbLocation = scalePixelForZoomedInTile(crumbLocation,crumbTileX,crumbTileY);
+  // decode the log front to back once - random access would re-decode from a keyframe per crumb
+  CrumbLog::Iterator it = (newestOnly ? _breadCrumbTrail.from(std::max(0, _breadCrumbTrail.size() - _deferredBreadCrumbs)) : _breadCrumbTrail.begin());
+  CrumbLog::Crumb packed;
+  while (it.next(packed))
+  {
+    const BreadCrumb crumb = unpackCrumb(packed);
+    pixel crumbLocation = convertGeoToPixelDouble(crumb._lat, crumb._long, featureMap);
+    if (isPixelOutsideScreenExtent(crumbLocation))
+      continue;
 
-      if (crumbTileX != diverTileX || crumbTileY != diverTileY)
-        continue;
-  
-      _rotatedBreadCrumbSprite->fillSprite(TFT_BLACK);
-      _breadCrumbSprite->pushRotated(*_rotatedBreadCrumbSprite,_breadCrumbTrail[i]._heading,TFT_BLACK); // BLACK is the transparent colour
-      _rotatedBreadCrumbSprite->pushToSprite(*_compositedScreenSprite,crumbLocation.x-_mapAttr.breadCrumbWidth/2,crumbLocation.y-_mapAttr.breadCrumbWidth/2,TFT_BLACK); // BLACK is the transparent colour
-    }
+    int16_t crumbTileX=0,crumbTileY=0;
+    crumbLocation = scalePixelForZoomedInTile(crumbLocation,crumbTileX,crumbTileY);
+
+    if (crumbTileX != tileX || crumbTileY != tileY)
+      continue;
+
+    crumbLocation = toHeadingUp(crumbLocation);
+    _rotatedBreadCrumbSprite->fillSprite(TFT_BLACK);
+    _breadCrumbSprite->pushRotated(*_rotatedBreadCrumbSprite,headingOnScreen(crumb._heading),TFT_BLACK); // BLACK is the transparent colour
+    _rotatedBreadCrumbSprite->pushToSprite(sprite,crumbLocation.x-_mapAttr.breadCrumbWidth/2,crumbLocation.y-_mapAttr.breadCrumbWidth/2,TFT_BLACK); // BLACK is the transparent colour
   }
 }
 
+void MapScreen_ex::setOverlayStatic(const overlayLayers layer, const bool isStatic)
+{
+  if (_overlayStatic[layer] == isStatic)
+    return;
+
+  // either way the baked base has to change: gain the layer or lose it
+  _overlayStatic[layer] = isStatic;
+  _overlayChanges++;
+  _staticOverlaysDirty = true;
+}
+
+void MapScreen_ex::invalidateOverlay(const overlayLayers layer)
+{
+  _overlayChanges++;
+  if (_overlayStatic[layer])
+    _staticOverlaysDirty = true;
+}
+
+void MapScreen_ex::drawStaticOverlaysToSprite(TFT_eSprite& sprite, const int16_t tileX, const int16_t tileY, const geo_map& featureMap)
+{
+  // same stacking order as the per-frame path
+  if (_overlayStatic[e_trace_overlay])
+    drawTracesToSprite(sprite, tileX, tileY, featureMap);
+
+  if (_overlayStatic[e_breadcrumb_overlay])
+    drawBreadCrumbTrailToSprite(sprite, tileX, tileY, featureMap);
+
+  if (_overlayStatic[e_pin_overlay])
+    drawPlacedPinsToSprite(sprite, tileX, tileY, featureMap);
+
+  _staticOverlaysDirty = false;
+}
+
 void MapScreen_ex::drawHeadingLineOnCompositeMapSprite(const double diverLatitude, const double diverLongitude, 
                                                             const double heading, const geo_map& featureMap)
 {
   int16_t tileX=0,tileY=0;
   pixel pDiver = convertGeoToPixelDouble(diverLatitude, diverLongitude, featureMap);
-  pDiver = scalePixelForZoomedInTile(pDiver,tileX,tileY);
+  pDiver = toHeadingUp(scalePixelForZoomedInTile(pDiver,tileX,tileY));
   
 //  const double hY_t3potoneuse=50;
   pixel pHeading;
 
-  double rads = heading * PI / 180.0;  
+  double rads = headingOnScreen(heading) * PI / 180.0;  
   pHeading.x = pDiver.x + _mapAttr.diverHeadingLinePixelLength * sin(rads);
   pHeading.y = pDiver.y - _mapAttr.diverHeadingLinePixelLength * cos(rads);
 
@@ -1046,12 +2564,14 @@ void MapScreen_ex::drawDiverOnCompositedMapSprite(const double latitude, const d
 
     int16_t diverTileX=0, diverTileY=0;
     pDiver = scalePixelForZoomedInTile(pDiver, diverTileX, diverTileY);
+    const pixel pDiverOnScreen = toHeadingUp(pDiver);
 
     if (_prevWaypointIndex != -1)
     {
       pixel p = convertGeoToPixelDouble(WraysburyWaypoints::waypoints[_prevWaypointIndex]._lat, WraysburyWaypoints::waypoints[_prevWaypointIndex]._long, featureMap);
       int16_t tileX=0,tileY=0;
       p = scalePixelForZoomedInTile(p,tileX,tileY);
+      p = toHeadingUp(p);
       if (tileX == diverTileX && tileY == diverTileY)  // only show last target sprite on screen if tiles match
         _lastTargetSprite->pushToSprite(*_compositedScreenSprite, p.x-_mapAttr.featureSpriteRadius,p.y-_mapAttr.featureSpriteRadius,TFT_BLACK);
     }
@@ -1060,7 +2580,7 @@ void MapScreen_ex::drawDiverOnCompositedMapSprite(const double latitude, const d
     {
       pixel p = convertGeoToPixelDouble(WraysburyWaypoints::waypoints[_targetWaypointIndex]._lat, WraysburyWaypoints::waypoints[_targetWaypointIndex]._long, featureMap);
       int16_t tileX=0,tileY=0;
-      p = scalePixelForZoomedInTile(p,tileX,tileY);
+      p = toHeadingUp(scalePixelForZoomedInTile(p,tileX,tileY));
   
       if (tileX == diverTileX && tileY == diverTileY)  // only show target sprite on screen if tiles match
         _targetSprite->pushToSprite(*_compositedScreenSprite, p.x-_mapAttr.featureSpriteRadius,p.y-_mapAttr.featureSpriteRadius,TFT_BLACK);
@@ -1070,12 +2590,12 @@ void MapScreen_ex::drawDiverOnCompositedMapSprite(const double latitude, const d
     if (_useDiverHeading)
     {
       _diverRotatedSprite->fillSprite(TFT_BLACK);
-      _diverSprite->pushRotated(*_diverRotatedSprite,heading,TFT_BLACK); // BLACK is the transparent colour
-      _diverRotatedSprite->pushToSprite(*_compositedScreenSprite,pDiver.x-_mapAttr.diverSpriteRadius,pDiver.y-_mapAttr.diverSpriteRadius,TFT_BLACK); // BLACK is the transparent colour
+      _diverSprite->pushRotated(*_diverRotatedSprite,headingOnScreen(heading),TFT_BLACK); // BLACK is the transparent colour
+      _diverRotatedSprite->pushToSprite(*_compositedScreenSprite,pDiverOnScreen.x-_mapAttr.diverSpriteRadius,pDiverOnScreen.y-_mapAttr.diverSpriteRadius,TFT_BLACK); // BLACK is the transparent colour
     }
     else
     {
-      _diverPlainSprite->pushToSprite(*_compositedScreenSprite,pDiver.x-_mapAttr.diverSpriteRadius,pDiver.y-_mapAttr.diverSpriteRadius,TFT_BLACK); // BLACK is the transparent colour
+      _diverPlainSprite->pushToSprite(*_compositedScreenSprite,pDiverOnScreen.x-_mapAttr.diverSpriteRadius,pDiverOnScreen.y-_mapAttr.diverSpriteRadius,TFT_BLACK); // BLACK is the transparent colour
     }
 }
 
@@ -1148,6 +2668,13 @@ void MapScreen_ex::drawFeaturesOnBaseMapSprite(const geo_map& featureMap, TFT_eS
 }
 
 MapScreen_ex::pixel MapScreen_ex::convertGeoToPixelDouble(double latitude, double longitude, const geo_map& mapToPlot) const
+{
+  double x, y;
+  convertGeoToFractionalPixel(latitude, longitude, mapToPlot, x, y);
+  return pixel((int16_t)x, (int16_t)y);
+}
+
+void MapScreen_ex::convertGeoToFractionalPixel(double latitude, double longitude, const geo_map& mapToPlot, double& x, double& y) const
 {  
   int16_t mapWidth = getTFTWidth(); // in pixels
   int16_t mapHeight = getTFTHeight(); // in pixels
@@ -1162,10 +2689,8 @@ MapScreen_ex::pixel MapScreen_ex::convertGeoToPixelDouble(double latitude, doubl
   double worldMapWidth = ((mapWidth / mapLngDelta) * 360.0) / (2.0 * PI);
   double mapOffsetY = (worldMapWidth / 2.0 * log((1.0 + sin(mapLatBottomRad)) / (1.0 - sin(mapLatBottomRad))));
 
-  int16_t x = (longitude - mapLngLeft) * ((double)mapWidth / mapLngDelta);
-  int16_t y = (double)mapHeight - ((worldMapWidth / 2.0L * log((1.0 + sin(latitudeRad)) / (1.0 - sin(latitudeRad)))) - (double)mapOffsetY);
-
-  return pixel(x,y);
+  x = (longitude - mapLngLeft) * ((double)mapWidth / mapLngDelta);
+  y = (double)mapHeight - ((worldMapWidth / 2.0L * log((1.0 + sin(latitudeRad)) / (1.0 - sin(latitudeRad)))) - (double)mapOffsetY);
 }
 
 void MapScreen_ex::debugScaledPixelForTile(pixel p, pixel pScaled, int16_t tileX,int16_t tileY) const
@@ -1190,6 +2715,7 @@ void MapScreen_ex::drawFeaturesOnSpecifiedMapToScreen(int featureIndex, int16_t
 
 void MapScreen_ex::drawFeaturesOnSpecifiedMapToScreen(const geo_map& featureAreaToShow, int16_t zoom, int16_t tileX, int16_t tileY)
 {
+    redrawNextFrame();
     _currentMap = &featureAreaToShow;
 
     if (featureAreaToShow.mapData)
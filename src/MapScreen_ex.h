@@ -6,6 +6,26 @@
 #include <array>
 #include <vector>
 
+#include "SiteFrame.h"
+#include "WaypointGrid.h"
+#include "NearestFeatureTracker.h"
+#include "ExitRaster.h"
+#include "WaypointLabelIndex.h"
+#include "CrumbPool.h"
+#include "CrumbLog.h"
+#include "CrumbJournal.h"
+#include "CrumbExporter.h"
+#include "TrailPolyline.h"
+#include "TraceLayer.h"
+#include "ComposedTileCache.h"
+#include "PanViewport.h"
+#include "ZoomScale.h"
+#include "AffineBlit.h"
+#include "DeadReckoner.h"
+#include "FrameBudget.h"
+#include "MapThumbnail.h"
+#include "MapExtentIndex.h"
+
 class TFT_eSPI;
 class TFT_eSprite;
 class NavigationWaypoint;
@@ -46,6 +66,8 @@ class MapScreen_ex
         uint16_t colour;
     };
 
+    enum breadCrumbStyles { e_breadcrumb_sprites, e_breadcrumb_polyline };
+
     class MapScreenAttr
     {
       public:
@@ -84,6 +106,36 @@ class MapScreen_ex
 
         uint16_t traceColour;
         int tracePointSize;
+
+        int maxBreadCrumbs;           // with breadCrumbBudgetBytesPerCrumb sizes the crumb log budget; 0 for the default
+        int maxPlacedPins;            // 0 for the default capacity
+
+        float breadCrumbDropMinDistance;  // metres between crumbs, replacing breadCrumbDropFixCount; 0 to drop by fix count
+
+        int breadCrumbStyle;              // breadCrumbStyles, default e_breadcrumb_sprites
+        int breadCrumbArrowSpacing;       // polyline style: pixels of path between direction arrows, 0 for the default
+
+        float traceSimplifyMetres;        // Douglas-Peucker tolerance for the trace overlay, 0 to keep every point
+
+        int composedTileCacheBytes;       // budget for cached composed base tiles, 0 for the default, negative for none
+
+        int panDeadbandPixels;            // zoom > 1: pan with the diver once this far from centre, 0 for fixed tiles
+
+        int headingUpThresholdDegrees;    // heading-up: turn the map again once the heading moves this far, 0 for the default
+
+        float frameSkipMetres;            // skip frames while the diver stays this close to the last one drawn, 0 to draw every fix
+        float frameSkipDegrees;           // and the heading this close, 0 for the default
+
+        int interpolatedFrameHz;          // drawInterpolatedFrame() rate between fixes, 0 to draw only on fixes
+
+        int frameBudgetMicros;            // put off optional layers once a frame runs this long, 0 to always draw them
+
+        int pngSliceMicros;               // a map switch decodes this long a frame with the old map up until done, 0 to decode whole
+        int pngSliceRows;                 // and at most this many rows a frame, 0 for no row limit
+
+        float mapSwitchHysteresisMetres;  // a switch off a detail map waits until the diver is this far past its edge, 0 to switch at once
+
+        int breadCrumbBudgetBytesPerCrumb;  // crumb log bytes per maxBreadCrumbs, 0 for the default 32, the old trail's RAM
     };
 
     class geo_map
@@ -123,6 +175,7 @@ class MapScreen_ex
         double _long;
         double _heading;
         double _depth;
+        SiteFrame::point _local;    // site-local metres, filled in by the accessors
 
       BreadCrumb(const double lat=0.0, const double lng=0.0, const double heading=0.0, const double depth=0.0) : _lat(lat),_long(lng),_heading(heading),_depth(depth) {}
     };
@@ -214,6 +267,7 @@ class MapScreen_ex
     virtual int16_t getTFTHeight() const = 0;
     
     void setTargetWaypointByLabel(const char* label);
+    int findWaypointsByLabelPrefix(const char* prefix, int* indices, const int maxIndices);
 
     void setUseDiverHeading(const bool use)
     {
@@ -227,6 +281,10 @@ class MapScreen_ex
     void drawFeaturesOnSpecifiedMapToScreen(int featureIndex, int16_t zoom=1, int16_t tileX=0, int16_t tileY=0);
     void drawFeaturesOnSpecifiedMapToScreen(const geo_map& featureAreaToShow, int16_t zoom=1, int16_t tileX=0, int16_t tileY=0);
     void drawDiverOnBestFeaturesMapAtCurrentZoom(const double diverLatitude, const double diverLongitude, const double diverHeading = 0);
+
+    // call as often as the loop allows: at interpolatedFrameHz redraws the diver and lines dead reckoned from the
+    // last fixes, over the base of the last full frame; true if it drew
+    bool drawInterpolatedFrame();
     void drawDiverOnCompositedMapSprite(const double latitude, const double longitude, const double heading, const geo_map& featureMap);
     void writeOverlayTextToCompositeMapSprite();
     
@@ -242,21 +300,70 @@ class MapScreen_ex
     double degreesCourseTo(double lat1, double long1, double lat2, double long2) const;
     double radiansCourseTo(double lat1, double long1, double lat2, double long2) const;
 
+    // planar distance/course on the site tangent plane - for per-frame navigation maths
+    float siteDistanceToWaypoint(const double lat, const double lng, const int waypointIndex) const;
+    float siteDegreesCourseToWaypoint(const double lat, const double lng, const int waypointIndex) const;
+    const SiteFrame& getSiteFrame() const { return _siteFrame; }
+
     int getClosestJettyIndex(double& distance, bool useFastApprox = false);
-    int getClosestFeatureIndex(double& distance, bool useFastApprox = false);
+    int getClosestFeatureIndex(double& distance, bool useFastApprox = false, const uint16_t categoryMask = WaypointGrid::allCategories);
+    int getTrackedNearestFeatureIndex(double& distance);
+
+    const NearestFeatureTracker& getNearestFeatureTracker() const { return _nearestFeatureTracker; }
  
-    void drawPNG(const char* filename, bool swapBytes);
+    const uint16_t* drawPNG(const char* filename, bool swapBytes);     // decoded pixels, nullptr if not loaded
     void testDrawPNG(const char* filename, bool swapBytes);
 
     int drawDirectionalLineOnCompositeSprite(const double diverLatitude, const double diverLongitude, 
                                                     const geo_map& featureMap, const int waypointIndex, uint16_t colour, int indicatorLength);
 
     void placePin(const double lat, const double lng, const double head, const double dep);
+    void clearPlacedPins();   // and the pin journal, so they don't come back at the next boot
 
     void drawPlacedPins(const double diverLatitude, const double diverLongitude, const geo_map& featureMap);
 
     void drawTracesOnCompositeMapSprite(const double diverLatitude, const double diverLongitude, const geo_map& featureMap);
 
+    // survey trace layers: every .trc file in /traces at init, else the compiled-in survey as layer 0
+    static const int s_maxTraceLayers = 8;
+    int addTraceLayer(const char* filename, const uint16_t colour, const bool visible = true);   // -1 if unreadable or full
+    int getTraceLayerCount() const                                { return _traceLayers.size(); }
+    // an index out of range reads as an empty, hidden layer and is otherwise ignored
+    const char* getTraceLayerName(const int i) const              { return isTraceLayer(i) ? _traceLayers[i].name() : ""; }
+    bool isTraceLayerVisible(const int i) const                   { return isTraceLayer(i) && _traceLayers[i].visible; }
+    void setTraceLayerVisible(const int i, const bool visible)    { if (isTraceLayer(i)) { _traceLayers[i].visible = visible;  invalidateOverlay(e_trace_overlay); } }
+    void toggleTraceLayer(const int i)                            { setTraceLayerVisible(i, !isTraceLayerVisible(i)); }
+    void setTraceLayerColour(const int i, const uint16_t colour)  { if (isTraceLayer(i)) { _traceLayers[i].colour = colour;  invalidateOverlay(e_trace_overlay); } }
+
+    // overlays are static - baked into the base map cache with the map, zoom and tile - or dynamic, drawn every frame
+    enum overlayLayers { e_trace_overlay, e_pin_overlay, e_breadcrumb_overlay, e_overlay_count };
+    void setOverlayStatic(const overlayLayers layer, const bool isStatic);
+    bool isOverlayStatic(const overlayLayers layer) const         { return _overlayStatic[layer]; }
+    void invalidateOverlay(const overlayLayers layer);            // its content changed; re-baked before the next frame if static
+
+    // frames left undrawn because nothing on them would have changed; call redrawNextFrame() after drawing over the map
+    void redrawNextFrame()            { _drawnFrame.valid = false; }
+    uint32_t getFramesSkipped() const { return _framesSkipped; }
+    uint32_t getFramesDrawn() const   { return _framesDrawn; }
+    uint32_t getFramesInterpolated() const  { return _framesInterpolated; }
+
+    // layers drawn over the base each frame, scheduled against frameBudgetMicros by priority; the diver always draws
+    enum frameLayers { e_traces_layer, e_crumbs_layer, e_pins_layer, e_lines_layer, e_title_layer, e_frame_layer_count };
+    void setLayerPriority(const frameLayers layer, const FrameBudget::priorities priority)  { _frameBudget.setPriority(layer, priority); }
+    const FrameBudget& getFrameBudget() const   { return _frameBudget; }
+
+    // a map switch's sliced decode, waiting on frames; call continueMapDecode() between fixes to finish it sooner
+    bool isMapDecoding() const;
+    void continueMapDecode();
+
+    // after the last map switch or boot: time to the first frame on the new map, from its thumbnail or not, and to full quality
+    uint32_t getFirstUsefulFrameMicros() const  { return _firstUsefulFrameUs; }
+    uint32_t getFullQualityFrameMicros() const  { return _fullQualityFrameUs; }
+
+    // detail map switches, and those straight back to the map just left - GPS jitter at a boundary
+    uint32_t getMapSwitches() const       { return _mapSwitches; }
+    uint32_t getMapSwitchThrash() const   { return _mapSwitchThrash; }
+
     void drawBreadCrumbTrailOnCompositeMapSprite(const double diverLatitude, const double diverLongitude, 
                                                             const double heading, const geo_map& featureMap);
 
@@ -273,6 +380,10 @@ class MapScreen_ex
     int16_t getZoom() const     { return _zoom; }
     void setZoom(const int16_t zoom);
 
+    // any zoom from 1x to 4x, e.g. 1.5x or 2.5x; getZoom() is then the next whole zoom up, the tiles across the map
+    void setFractionalZoom(const float zoom);
+    float getZoomScale() const  { return zoomFixed() / (float)ZoomScale::s_one; }
+
     void setDrawAllFeatures(const bool showAll)
     { 
       _drawAllFeatures = showAll;
@@ -287,11 +398,31 @@ class MapScreen_ex
     bool getDrawAllFeatures() const
     { return _drawAllFeatures; }
 
+    // turn the map so the diver's heading is straight up; needs the base map cache
+    void setHeadingUp(const bool headingUp);
+    bool isHeadingUp() const    { return _headingUp; }
+    void toggleHeadingUp()      { setHeadingUp(!_headingUp); }
+
     void toggleShowBreadCrumbTrail();
     void toggleRecordBreadCrumbTrail();
     void setBreadCrumbTrailRecord(const bool enable);
     void clearBreadCrumbTrail();
 
+    // call from loop() between frames - writes journalled crumbs and pins to LittleFS off the render path,
+    // and pre-renders the tile the next cycleZoom will show
+    void serviceIdle();
+
+    // upload: begin, then read() chunks into the caller's buffer until it returns 0; thinning waits until done, or
+    // until no chunk has been read for _breadCrumbExportStallMs, when the export is cancelled
+    void beginBreadCrumbExport(const CrumbExporter::Format format);
+    size_t readBreadCrumbExport(uint8_t* chunk, const size_t capacity);
+    CrumbExporter& getBreadCrumbExporter()  { return _breadCrumbExporter; }
+
+    int getBreadCrumbCount() const    { return _breadCrumbTrail.size(); }
+    BreadCrumb getBreadCrumb(const int i) const;
+    int getPlacedPinCount() const     { return _placedPins.size(); }
+    BreadCrumb getPlacedPin(const int i) const;
+
     void testAnimatingDiverSpriteOnCurrentMap();
     void testDrawingMapsAndFeatures(uint8_t& currentMap, int16_t& zoom);
 
@@ -310,12 +441,19 @@ class MapScreen_ex
     virtual void setLocationLatLong()
     {
       _location = e_wraysbury_location;
+      invalidateWaypointIndices();    // re-establish the site origin and indices for the new location
     }
 
   protected:
     int16_t _zoom;
     int16_t _prevZoom;
 
+    // 16.16 zoom when between whole zooms, else 0; _zoomScale holds the zoom being drawn and its column tables
+    uint32_t _fractionalZoom = 0;
+    uint32_t _drawnZoomFixed = 0;
+    ZoomScale _zoomScale;
+    uint32_t zoomFixed() const  { return (_fractionalZoom ? _fractionalZoom : (uint32_t)_zoom << 16); }
+
     TFT_eSPI& _tft;
 
 
@@ -354,19 +492,228 @@ class MapScreen_ex
 
     bool _drawAllFeatures;
 
-    static const int _maxBreadCrumbs=1000;
-    BreadCrumb _breadCrumbTrail[_maxBreadCrumbs];
+    // composed base tiles by map, zoom, tile and feature drawing, only with the base map cache
+#ifdef BOARD_HAS_PSRAM
+    static const size_t _defaultComposedTileCacheBytes=1536*1024;
+#else
+    static const size_t _defaultComposedTileCacheBytes=0;
+#endif
+    ComposedTileCache _composedTiles;
+    bool _lastBaseTileFromCache = false;
+    bool composeBaseTile(const geo_map& map, TFT_eSprite& sprite);
+    // the map image onto the tile to display: pushImageScaled at whole zooms, else the fractional zoom's tables
+    void scaleMapImageToSprite(TFT_eSprite& sprite, const uint16_t* pixels, const geo_map& map);
+
+    // idle pre-rendering of the next zoom in the cycle and the all-lake map, into the composed tile cache
+    std::unique_ptr<TFT_eSprite> _prerenderSprite;
+    const geo_map* _lastDetailMap = nullptr;
+    ComposedTileCache::Key _prerenderFailedKey = { nullptr, 0, 0, 0, false };
+    uint32_t _zoomCycleStartUs = 0;
+    void prerenderZoomCycle();
+    bool prerenderTile(const geo_map& map, const int16_t zoom, const bool allLake);
+
+    // diver-centred view at zoom > 1: the base sprite holds the map image as the viewport's ring buffer,
+    // and features, scale and static overlays go straight onto the composite each frame
+    PanViewport _panViewport;
+    bool _panning = false;
+    bool isPanningAvailable() const  { return _mapAttr.panDeadbandPixels > 0 && _zoom > 1 && !_showAllLake && useBaseMapCache(); }
+    const uint16_t* panSourcePixels(const geo_map& map);
+
+    // heading-up: the base with its static overlays is turned about the diver into _headingUpSprite only when the base
+    // changes, the heading has moved past the threshold or the diver has moved off the pivot; overlays drawn over it each
+    // frame go through the same matrix
+    static const int _defaultHeadingUpThresholdDegrees=5;
+    static const int _headingUpRecentrePixels=8;
+    std::unique_ptr<TFT_eSprite> _headingUpSprite;
+    AffineBlit _headingUpBlit;
+    bool _headingUp = false;
+    bool _headingUpValid = false;         // _headingUpSprite holds the current base turned by _headingUpBlit
+    bool _headingUpDrawing = false;       // the frame's dynamic overlays are being drawn over the turned base
+    double _headingUpHeading = 0;
+    pixel _headingUpPivot;                // the diver's tile pixel the base was turned about, placed at the screen centre
+    bool isHeadingUpAvailable() const;
+    pixel toHeadingUp(const pixel p) const;
+    double headingOnScreen(const double heading) const  { return heading + (_headingUpDrawing ? _headingUpBlit.rotationDegrees() : 0); }
+
+    // frame skip: what the last frame was drawn from. A fix is only drawn once the diver has moved or turned past
+    // the deadbands from it, or anything else that's drawn has changed
+    class DrawnFrame
+    {
+      public:
+        bool valid = false;
+        SiteFrame::point position;
+        double heading = 0;
+        uint32_t zoomFixed = 0;
+        bool allLake = false;
+        bool drawAllFeatures = false;
+        bool headingUp = false;
+        bool useDiverHeading = false;
+        bool showBreadCrumbTrail = false;
+        int targetWaypointIndex = -1;
+        int prevWaypointIndex = -1;
+        uint32_t overlayChanges = 0;
+
+        bool sameSettings(const DrawnFrame& f) const
+        {
+          return zoomFixed == f.zoomFixed && allLake == f.allLake && drawAllFeatures == f.drawAllFeatures && headingUp == f.headingUp &&
+                 useDiverHeading == f.useDiverHeading && showBreadCrumbTrail == f.showBreadCrumbTrail &&
+                 targetWaypointIndex == f.targetWaypointIndex && prevWaypointIndex == f.prevWaypointIndex && overlayChanges == f.overlayChanges;
+        }
+
+        bool samePose(const DrawnFrame& f) const
+        {
+          return position.e == f.position.e && position.n == f.position.n && heading == f.heading;
+        }
+    };
+    static constexpr float _defaultFrameSkipDegrees=1.0f;
+    DrawnFrame _drawnFrame;
+    uint32_t _framesSkipped = 0;
+    uint32_t _framesDrawn = 0;
+    uint32_t _framesSkippedSinceDrawn = 0;
+    DrawnFrame frameToDraw(const double diverLatitude, const double diverLongitude, const double diverHeading);
+    bool isFrameUnchanged(const DrawnFrame& frame) const;
+
+    // the deferred crumb path under a tight budget: the newest crumbs or polyline runs, the rest the next frame
+    static const int _deferredBreadCrumbs=32;
+    static const int _deferredBreadCrumbRuns=2;
+    FrameBudget _frameBudget;
+    void logFrameBudgetMiss();
+
+    // sliced decoding: false while the map's image is still being decoded, running a slice of it
+    bool isMapImageReady(const geo_map& map);
+    void drawMapDecodeProgress(TFT_eSprite& sprite) const;
+    static const uint32_t _pngSliceStackBytes = 16384;
+
+    // while a map's image decodes in slices, its "<png>.thumb" stands in for it rather than holding the old map
+    MapThumbnail _thumbnail;
+    bool _baseFromThumbnail = false;
+    bool showsThumbnail(const geo_map& map);
+
+    // a map switch or boot: from the frame the map was wanted to its first useful and first full quality frames
+    const geo_map* _mapSwitchTarget = nullptr;
+    uint32_t _mapSwitchStartUs = 0;
+    bool _mapSwitchShown = false;
+    uint32_t _firstUsefulFrameUs = 0;
+    uint32_t _fullQualityFrameUs = 0;
+    void noteMapWanted(const geo_map* map, const uint32_t startUs);
+    void noteMapSwitchFrame(const geo_map* shown, const uint32_t nowUs);
+
+    // detail map extents for initCurrentMap, and hysteresis on getNextMapByPixelLocation's switches
+    MapExtentIndex _mapExtents;
+    void ensureMapExtentIndex();
+    const geo_map* _proposedMap = nullptr;
+    bool _proposedPassed = false;
+    const geo_map* _mapSwitchedFrom = nullptr;
+    uint32_t _mapSwitchedMs = 0;
+    uint32_t _mapSwitches = 0;
+    uint32_t _mapSwitchThrash = 0;
+    uint32_t _mapSwitchesAvoided = 0;
+    static const uint32_t _mapThrashWindowMs = 30000;
+    const geo_map* applyMapSwitchHysteresis(const geo_map* proposed, const double diverLatitude, const double diverLongitude);
+
+    // interpolated frames: the diver eases between fixes, the base and static overlays are the last full frame's
+    DeadReckoner _deadReckoner;
+    uint32_t _lastFrameMs = 0;
+    uint32_t _framesInterpolated = 0;
+    uint32_t _framesInterpolationSkipped = 0;   // due, but the estimate was where the last frame drew the diver
+    uint32_t _interpolatedSinceFix = 0;
+    uint32_t _interpolatedDrawMicrosSinceFix = 0;
+    uint32_t _interpolatedDisplayMicrosSinceFix = 0;
+    uint32_t _interpolatedLongestMicrosSinceFix = 0;
+    void logInterpolatedFrames();
+    bool estimateShownDiver(const uint32_t ms, const geo_map& map, double& latitude, double& longitude, double& heading);
+    bool copyBaseToComposite(const geo_map& map);
+    void composePanningBase(const geo_map& map);
+
+    // top-left of a tile in zoomed map pixels; while panning, tiles are relative to the viewport
+    int32_t tileOriginX(const int16_t tileX) const  { return (_panning ? _panViewport.originX() : 0) + (int32_t)getTFTWidth() * tileX; }
+    int32_t tileOriginY(const int16_t tileY) const  { return (_panning ? _panViewport.originY() : 0) + (int32_t)getTFTHeight() * tileY; }
+
+    // delta-encoded crumb log and packed pin records, allocated by initBreadCrumbStorage (PSRAM when available)
+    static const int _defaultMaxBreadCrumbs=1000;
+    static const int _defaultBreadCrumbBudgetBytesPerCrumb=32;   // what each crumb of the fixed trail took in RAM
+
+    // once the log is 3/4 full older crumbs are thinned, the tolerance doubling with age; the newest keep every crumb
+    static constexpr float _breadCrumbThinningToleranceMetres=1.0f;
+    static const int _breadCrumbFullResolutionCount=256;
+    CrumbLog _breadCrumbTrail;
+    SiteFrame::point _lastBreadCrumbLocal;
     bool _showBreadCrumbTrail = true;
     bool _recordBreadCrumbTrail = false;
-    int _nextCrumbIndex=0;
     uint8_t _breadCrumbCountDown = 0;
 
-    static const int _maxPlacedPins = 50;
-    BreadCrumb _placedPins[_maxPlacedPins];
-    int _placedPinIndex = 0;
+    static const int _defaultMaxPlacedPins = 50;
+    CrumbPool _placedPins;
+    std::vector<uint32_t> _placedPinTimesMs;   // exact for compactPinJournal: the pool keeps seconds deltas that saturate at 127s
+
+    // crumbs and pins are journalled to LittleFS as recorded and replayed by initBreadCrumbStorage
+    CrumbJournal _breadCrumbJournal;
+    CrumbJournal _pinJournal;
+
+    CrumbExporter _breadCrumbExporter;
+    static const uint32_t _breadCrumbExportStallMs = 30000;
+    uint32_t _breadCrumbExportBytesSeen = 0;
+    uint32_t _breadCrumbExportProgressMs = 0;
+
+    // polyline trail style, in zoomed pixels of _breadCrumbPolylineMap and extended as crumbs are added
+    static const int16_t _breadCrumbPolylineSpacing=2;
+    static const int _defaultBreadCrumbArrowSpacing=40;
+    static const int _breadCrumbArrowLength=5;
+    TrailPolyline _breadCrumbPolyline;
+    const geo_map* _breadCrumbPolylineMap = nullptr;
+    uint32_t _breadCrumbPolylineZoom = 0;      // 16.16
+    int _breadCrumbPolylineCrumbs = 0;
+    uint32_t _breadCrumbPolylineThinned = 0;
+
+    void initBreadCrumbStorage();
+    BreadCrumb unpackCrumb(const CrumbPool& pool, const int i) const;
+    BreadCrumb unpackCrumb(const CrumbLog::Crumb& c) const;
+    bool isBreadCrumbDropDue(const double diverLatitude, const double diverLongitude);
+    void thinBreadCrumbTrail();
+    void recoverBreadCrumbJournals();
+    bool compactBreadCrumbJournal();
+    bool compactPinJournal();
+    void updateBreadCrumbPolyline(const geo_map& featureMap);
+    void recordBreadCrumbTrail(const double diverLatitude, const double diverLongitude, const double heading);
+    void drawRecordIndicator();
+
+    // traces and pins change only when edited, crumbs every few fixes, so by default only the crumbs are redrawn per frame
+    bool _overlayStatic[e_overlay_count] = { true, true, false };
+    uint32_t _overlayChanges = 0;       // bumped by every overlay edit, static or not
+    bool _staticOverlaysDirty = true;
+    void drawStaticOverlaysToSprite(TFT_eSprite& sprite, const int16_t tileX, const int16_t tileY, const geo_map& featureMap);
+    void drawTracesToSprite(TFT_eSprite& sprite, const int16_t tileX, const int16_t tileY, const geo_map& featureMap);
+    void drawBreadCrumbTrailToSprite(TFT_eSprite& sprite, const int16_t tileX, const int16_t tileY, const geo_map& featureMap,
+                                     const bool newestOnly = false);
+    void drawPlacedPinsToSprite(TFT_eSprite& sprite, const int16_t tileX, const int16_t tileY, const geo_map& featureMap);
+
+    // each layer caches its own projected points per map slot, 0 for the detail map and 1 for the all-lake map
+    std::vector<TraceLayer> _traceLayers;
+    void initTraceLayers();
+    bool isTraceLayer(const int i) const    { return i >= 0 && i < (int)_traceLayers.size(); }
+    TraceLod& buildTraceLayerLod(TraceLayer& layer, const int slot, const geo_map& featureMap);
 
     static const int s_exitWaypointSize=10; 
     std::array<int,s_exitWaypointSize> _exitWaypointIndices;
+
+    // site tangent plane and each waypoint in it, rebuilt with the indices below
+    SiteFrame _siteFrame;
+    std::vector<SiteFrame::point> _waypointLocal;     // indexed from _firstWaypointIndex
+
+    // indices over the site's waypoints, rebuilt if the waypoint range changes
+    WaypointLabelIndex _labelIndex;
+    WaypointGrid _featureGrid;
+    WaypointGrid _exitGrid;
+    int _featureGridFirstIndex = -1;
+    int _featureGridEndIndex = -1;
+
+    // nearest feature across consecutive fixes, only re-searches the grid once the diver leaves its safety radius
+    NearestFeatureTracker _nearestFeatureTracker;
+
+    // nearest exit per 2m cell, built or loaded from LittleFS on first use
+    ExitRaster _exitRaster;
+    bool _exitRasterAttempted = false;
+    void ensureExitRaster();
  
     void initSprites();
 
@@ -383,6 +730,9 @@ class MapScreen_ex
 
 protected:
     void initExitWaypoints();
+    void initWaypointSpatialIndex();
+    void ensureWaypointIndices();
+    void invalidateWaypointIndices() { _featureGridFirstIndex = _featureGridEndIndex = -1; }
     struct BoundingBox
     {
       MapScreen_ex::pixel topLeft;
@@ -402,6 +752,7 @@ protected:
 
     bool isPixelOutsideScreenExtent(const MapScreen_ex::pixel loc) const;
     pixel convertGeoToPixelDouble(double latitude, double longitude, const geo_map& mapToPlot) const;
+    void convertGeoToFractionalPixel(double latitude, double longitude, const geo_map& mapToPlot, double& x, double& y) const;
 
   double _distanceToNearestExit = 0.0;  
   double _nearestExitBearing = 0.0;
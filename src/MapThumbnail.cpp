@@ -0,0 +1,67 @@
+#include "MapThumbnail.h"
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <FS.h>
+
+#include <algorithm>
+
+static const char* s_thumbnailSuffix = ".thumb";
+
+MapThumbnail::MapThumbnail() : _loaded(false), _width(0), _height(0), _fullWidth(0), _fullHeight(0), _loadMicros(0)
+{
+}
+
+bool MapThumbnail::load(const char* pngFilename, const int16_t fullWidth, const int16_t fullHeight)
+{
+  if (pngFilename == nullptr)
+    return false;
+
+  if (_pngFilename == pngFilename)
+    return _loaded;
+
+  const uint32_t start = micros();
+  _pngFilename = pngFilename;
+  _loaded = false;
+  // rounded up, so a part block at the right and bottom still has a thumbnail pixel
+  _width = (fullWidth + s_divisor - 1) / s_divisor;
+  _height = (fullHeight + s_divisor - 1) / s_divisor;
+  _fullWidth = fullWidth;
+  _fullHeight = fullHeight;
+
+  const std::string filename = _pngFilename + s_thumbnailSuffix;
+  if (_width <= 0 || _height <= 0 || !LittleFS.exists(filename.c_str()))
+    return false;
+
+  fs::File f = LittleFS.open(filename.c_str(), FILE_READ);
+  if (!f)
+    return false;
+
+  // a thumbnail made for another screen size would land in the wrong place
+  const size_t bytes = (size_t)_width * _height * sizeof(uint16_t);
+  _pixels.resize((size_t)_width * _height);
+  _loaded = (f.size() == bytes && f.read((uint8_t*)_pixels.data(), bytes) == bytes);
+  f.close();
+
+  _loadMicros = micros() - start;
+  return _loaded;
+}
+
+void MapThumbnail::scaleRect(uint16_t* dest, const uint32_t zoomFixed, const int32_t originX, const int32_t originY,
+                             const int16_t w, const int16_t h, const bool swapBytes)
+{
+  if (!_loaded)
+    return;
+
+  _scale.set(zoomFixed * s_divisor, _width, _height);
+
+  // the rounded up thumbnail reaches past the image by up to a block, which the full image leaves to the back colour
+  const int32_t fullZoomedWidth = ((int64_t)_fullWidth * zoomFixed) >> 16;
+  const int32_t fullZoomedHeight = ((int64_t)_fullHeight * zoomFixed) >> 16;
+  const int32_t columns = std::min<int32_t>(w, fullZoomedWidth - originX);
+  const int32_t rows = std::min<int32_t>(h, fullZoomedHeight - originY);
+  if (columns <= 0 || rows <= 0)
+    return;
+
+  _scale.scaleRect(dest, _pixels.data(), originX, originY, columns, rows, swapBytes, w);
+}
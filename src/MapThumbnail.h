@@ -0,0 +1,51 @@
+#ifndef MapThumbnail_h
+#define MapThumbnail_h
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "ZoomScale.h"
+
+/* Low resolution stand-in for a map image, shown while the image itself is
+ * still decoding.
+ *
+ * Each map PNG may have a "<png>.thumb" beside it in LittleFS: raw RGB565 at
+ * 1/s_divisor of the image across and down, rounded up, in the byte order the
+ * PNG decodes to, so a few KB for a screen-sized map. tools/make_thumbnails.py
+ * makes them. Loading it is one small read, and it
+ * is scaled up by the same table scaler as a fractional zoom, at s_divisor
+ * times the zoom, so it lands under exactly the tile the full image would. The
+ * last thumbnail looked for is kept, found or not, so a held map doesn't go
+ * back to the filesystem each frame.
+ */
+class MapThumbnail
+{
+  public:
+    static const int s_divisor = 8;
+
+    MapThumbnail();
+
+    // true if pngFilename's thumbnail is loaded, for a fullWidth x fullHeight image
+    bool load(const char* pngFilename, const int16_t fullWidth, const int16_t fullHeight);
+    bool isLoadedFor(const char* pngFilename) const   { return _loaded && pngFilename && _pngFilename == pngFilename; }
+
+    // as ZoomScale::scaleRect for the full image at zoomFixed
+    void scaleRect(uint16_t* dest, const uint32_t zoomFixed, const int32_t originX, const int32_t originY,
+                   const int16_t w, const int16_t h, const bool swapBytes);
+
+    uint32_t loadMicros() const   { return _loadMicros; }
+
+  private:
+    std::string _pngFilename;
+    bool _loaded;
+    int16_t _width;
+    int16_t _height;
+    int16_t _fullWidth;
+    int16_t _fullHeight;
+    std::vector<uint16_t> _pixels;
+    ZoomScale _scale;
+    uint32_t _loadMicros;
+};
+
+#endif
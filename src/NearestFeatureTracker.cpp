@@ -0,0 +1,50 @@
+#include "NearestFeatureTracker.h"
+
+#include "NavigationWaypoints.h"
+
+// allow for rounding in the exact distance function when comparing against the safety radius
+static const double s_safetyRadiusSlackMetres = 0.01;
+
+NearestFeatureTracker::NearestFeatureTracker(const WaypointGrid& grid, WaypointGrid::ExactDistanceFn exactDistance) :
+                                                                _grid(grid),
+                                                                _exactDistance(exactDistance),
+                                                                _index(-1),
+                                                                _categoryMask(WaypointGrid::allCategories),
+                                                                _searchLat(0),
+                                                                _searchLong(0),
+                                                                _safetyRadius(0),
+                                                                _fastPathCount(0),
+                                                                _fullSearchCount(0)
+{
+}
+
+void NearestFeatureTracker::reset()
+{
+  _index = -1;
+  _safetyRadius = 0;
+}
+
+int NearestFeatureTracker::update(const double lat, const double lng, double& distance, const uint16_t categoryMask)
+{
+  if (_index != -1 && categoryMask == _categoryMask)
+  {
+    const double moved = _exactDistance(_searchLat, _searchLong, lat, lng);
+    if (moved < _safetyRadius)
+    {
+      const NavigationWaypoint& w = _grid.waypoints()[_index];
+      distance = _exactDistance(lat, lng, w._lat, w._long);
+      _fastPathCount++;
+      return _index;
+    }
+  }
+
+  double secondDistance = 1e99;
+  _index = _grid.nearest(lat, lng, distance, categoryMask, &secondDistance);
+  _categoryMask = categoryMask;
+  _searchLat = lat;
+  _searchLong = lng;
+  _safetyRadius = (_index == -1 ? 0 : (secondDistance - distance) / 2.0 - s_safetyRadiusSlackMetres);
+  _fullSearchCount++;
+
+  return _index;
+}
@@ -0,0 +1,47 @@
+#ifndef NearestFeatureTracker_h
+#define NearestFeatureTracker_h
+
+#include <stdint.h>
+
+#include "WaypointGrid.h"
+
+/* Tracks the nearest waypoint across consecutive fixes.
+ *
+ * After each full grid search the tracker remembers where it searched from and
+ * half the gap between the nearest and second-nearest exact distances. Moving
+ * by d changes every distance by at most d, so while the diver stays closer
+ * than that to the search position the winner cannot change and only the
+ * winner's distance needs recomputing. Results are identical to a full search.
+ */
+class NearestFeatureTracker
+{
+  public:
+    NearestFeatureTracker(const WaypointGrid& grid, WaypointGrid::ExactDistanceFn exactDistance);
+
+    // returns the nearest waypoint index (or -1) and its exact distance in metres
+    int update(const double lat, const double lng, double& distance,
+               const uint16_t categoryMask = WaypointGrid::allCategories);
+
+    void reset();
+
+    uint32_t fastPathCount() const      { return _fastPathCount; }
+    uint32_t fullSearchCount() const    { return _fullSearchCount; }
+    double safetyRadius() const         { return _safetyRadius; }
+
+    void resetCounters()                { _fastPathCount = _fullSearchCount = 0; }
+
+  private:
+    const WaypointGrid& _grid;
+    WaypointGrid::ExactDistanceFn _exactDistance;
+
+    int _index;
+    uint16_t _categoryMask;
+    double _searchLat;
+    double _searchLong;
+    double _safetyRadius;
+
+    uint32_t _fastPathCount;
+    uint32_t _fullSearchCount;
+};
+
+#endif
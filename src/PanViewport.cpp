@@ -0,0 +1,120 @@
+#include "PanViewport.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+
+PanViewport::PanViewport() : _originX(0), _originY(0), _zoomFixed(ZoomScale::s_one), _width(0), _height(0),
+                             _filled(false), _ringOriginX(0), _ringOriginY(0), _ringX(0), _ringY(0),
+                             _ring(nullptr), _source(nullptr)
+{
+}
+
+void PanViewport::follow(const float x, const float y, const ZoomScale& zoom, const int16_t width, const int16_t height,
+                         const int deadband, const bool recentre)
+{
+  if (zoom.fixed() != _zoomFixed || width != _width || height != _height)
+    _filled = false;
+
+  _zoomFixed = zoom.fixed();
+  _width = width;
+  _height = height;
+
+  const float centreX = _originX + width / 2;
+  const float centreY = _originY + height / 2;
+
+  if (recentre || !_filled)
+  {
+    _originX = x - width / 2;
+    _originY = y - height / 2;
+  }
+  else
+  {
+    if (x - centreX > deadband)       _originX = x - deadband - width / 2;
+    else if (centreX - x > deadband)  _originX = x + deadband - width / 2;
+
+    if (y - centreY > deadband)       _originY = y - deadband - height / 2;
+    else if (centreY - y > deadband)  _originY = y + deadband - height / 2;
+  }
+
+  // never past the edge of the map
+  _originX = std::max<int32_t>(0, std::min<int32_t>(_originX, zoom.zoomedWidth() - width));
+  _originY = std::max<int32_t>(0, std::min<int32_t>(_originY, zoom.zoomedHeight() - height));
+}
+
+void PanViewport::fill(const ZoomScale& zoom, const int16_t screenX, const int16_t screenY, const int16_t w, const int16_t h, const bool swapBytes)
+{
+  for (int sy = screenY; sy < screenY + h; sy++)
+  {
+    const uint16_t* sourceRow = _source + (size_t)zoom.sourceRow(_originY + sy) * _width;
+    uint16_t* ringRow = _ring + (size_t)((sy + _ringY) % _height) * _width;
+
+    int rx = (screenX + _ringX) % _width;
+    int32_t mapX = _originX + screenX;
+    for (int sx = 0; sx < w; sx++, mapX++)
+    {
+      const uint16_t c = sourceRow[zoom.sourceColumn(mapX)];
+      ringRow[rx] = (swapBytes ? (uint16_t)((c >> 8) | (c << 8)) : c);
+      if (++rx == _width)
+        rx = 0;
+    }
+  }
+}
+
+uint32_t PanViewport::update(uint16_t* ring, const uint16_t* source, const ZoomScale& zoom, const bool swapBytes)
+{
+  if (ring == nullptr || source == nullptr || _width <= 0 || _height <= 0 || zoom.fixed() != _zoomFixed)
+    return 0;
+
+  const int32_t dx = _originX - _ringOriginX;
+  const int32_t dy = _originY - _ringOriginY;
+
+  if (!_filled || ring != _ring || source != _source || abs(dx) >= _width || abs(dy) >= _height)
+  {
+    _ring = ring;
+    _source = source;
+    _ringX = _ringY = 0;
+    _ringOriginX = _originX;
+    _ringOriginY = _originY;
+    _filled = true;
+
+    fill(zoom, 0, 0, _width, _height, swapBytes);
+    return (uint32_t)_width * _height;
+  }
+
+  if (dx == 0 && dy == 0)
+    return 0;
+
+  // rotate the ring so screen 0,0 follows the origin; everything still on screen stays where it is
+  _ringX = ((_ringX + dx) % _width + _width) % _width;
+  _ringY = ((_ringY + dy) % _height + _height) % _height;
+  _ringOriginX = _originX;
+  _ringOriginY = _originY;
+
+  // then scale in the columns and rows that came on screen
+  const int16_t columns = abs(dx);
+  const int16_t rows = abs(dy);
+  if (columns > 0)
+    fill(zoom, dx > 0 ? _width - columns : 0, 0, columns, _height, swapBytes);
+  if (rows > 0)
+    fill(zoom, 0, dy > 0 ? _height - rows : 0, _width, rows, swapBytes);
+
+  return (uint32_t)columns * _height + (uint32_t)rows * _width;
+}
+
+void PanViewport::copyTo(uint16_t* screen) const
+{
+  if (!_filled || screen == nullptr)
+    return;
+
+  // each screen row is the ring row from _ringX to the end, then from the start up to _ringX
+  const size_t head = (size_t)(_width - _ringX) * sizeof(uint16_t);
+  const size_t tail = (size_t)_ringX * sizeof(uint16_t);
+  for (int sy = 0; sy < _height; sy++)
+  {
+    const uint16_t* ringRow = _ring + (size_t)((sy + _ringY) % _height) * _width;
+    uint16_t* screenRow = screen + (size_t)sy * _width;
+    memcpy(screenRow, ringRow + _ringX, head);
+    memcpy(screenRow + (_width - _ringX), ringRow, tail);
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef PanViewport_h
+#define PanViewport_h
+
+#include <stdint.h>
+
+#include "ZoomScale.h"
+
+/* A screen-sized window onto a zoomed map that follows the diver, instead of
+ * snapping between fixed tiles.
+ *
+ * The origin (the screen's top-left, in zoomed map pixels) only moves once the
+ * diver is more than the deadband from the centre, and then just far enough to
+ * bring them back inside it. The base image is kept in a ring buffer: moving
+ * the view rotates the ring's origin rather than shifting pixels, and only the
+ * newly exposed rows and columns are scaled in from the source image, so the
+ * cost of a frame follows how far the view moved. copyTo() unrolls the ring
+ * into a screen buffer, the copy that was already made each frame.
+ */
+class PanViewport
+{
+  public:
+    PanViewport();
+
+    // the next update() refills the whole ring
+    void reset()                    { _filled = false; }
+
+    // moves the origin to keep x,y (zoomed map pixels) within deadband of the centre, or centres on it
+    void follow(const float x, const float y, const ZoomScale& zoom, const int16_t width, const int16_t height,
+                const int deadband, const bool recentre);
+
+    // brings the ring up to the origin from source, the unzoomed image zoom was set for; returns pixels filled
+    uint32_t update(uint16_t* ring, const uint16_t* source, const ZoomScale& zoom, const bool swapBytes);
+
+    void copyTo(uint16_t* screen) const;
+
+    int32_t originX() const         { return _originX; }
+    int32_t originY() const         { return _originY; }
+
+  private:
+    void fill(const ZoomScale& zoom, const int16_t screenX, const int16_t screenY, const int16_t w, const int16_t h, const bool swapBytes);
+
+    int32_t _originX;
+    int32_t _originY;
+    uint32_t _zoomFixed;
+    int16_t _width;
+    int16_t _height;
+
+    // what the ring holds: the origin it was filled for, and where screen 0,0 sits in it
+    bool _filled;
+    int32_t _ringOriginX;
+    int32_t _ringOriginY;
+    int16_t _ringX;
+    int16_t _ringY;
+    uint16_t* _ring;
+    const uint16_t* _source;
+};
+
+#endif
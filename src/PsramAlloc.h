@@ -0,0 +1,24 @@
+#ifndef PsramAlloc_h
+#define PsramAlloc_h
+
+#include <stdlib.h>
+#include <esp_heap_caps.h>
+
+// Large buffers go to PSRAM when the board has it, otherwise the internal heap.
+// Either way the result is released with psramFree().
+inline void* psramMalloc(const size_t bytes)
+{
+#ifdef BOARD_HAS_PSRAM
+  void* p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (p)
+    return p;
+#endif
+  return malloc(bytes);
+}
+
+inline void psramFree(void* p)
+{
+  free(p);
+}
+
+#endif
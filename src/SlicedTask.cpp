@@ -0,0 +1,90 @@
+#include "SlicedTask.h"
+
+#include <Arduino.h>
+#include <freertos/task.h>
+
+SlicedTask::SlicedTask() : _resumed(nullptr), _yielded(nullptr), _job(nullptr), _context(nullptr), _running(false), _finished(false),
+                           _sliceStartMicros(0), _sliceMicros(0), _sliceSteps(0), _steps(0), _slices(0), _longestSliceMicros(0)
+{
+}
+
+SlicedTask::~SlicedTask()
+{
+  finish();
+  if (_resumed)
+    vSemaphoreDelete(_resumed);
+  if (_yielded)
+    vSemaphoreDelete(_yielded);
+}
+
+bool SlicedTask::start(job j, void* context, const char* name, const uint32_t stackBytes)
+{
+  if (_running)
+    return false;
+
+  if (_resumed == nullptr)
+    _resumed = xSemaphoreCreateBinary();
+  if (_yielded == nullptr)
+    _yielded = xSemaphoreCreateBinary();
+  if (_resumed == nullptr || _yielded == nullptr)
+    return false;
+
+  _job = j;
+  _context = context;
+  _finished = false;
+  _slices = 0;
+  _longestSliceMicros = 0;
+
+  // on the caller's core and at its priority: the task waits for its first resume() before doing anything
+  TaskHandle_t task = nullptr;
+  if (xTaskCreatePinnedToCore(run, name, stackBytes, this, uxTaskPriorityGet(nullptr), &task, xPortGetCoreID()) != pdPASS)
+    return false;
+
+  _running = true;
+  return true;
+}
+
+bool SlicedTask::resume(const uint32_t sliceMicros, const uint32_t sliceSteps)
+{
+  if (!_running)
+    return true;
+
+  _sliceMicros = sliceMicros;
+  _sliceSteps = sliceSteps;
+  _steps = 0;
+  _sliceStartMicros = micros();
+
+  xSemaphoreGive(_resumed);
+  xSemaphoreTake(_yielded, portMAX_DELAY);
+
+  const uint32_t took = micros() - _sliceStartMicros;
+  if (took > _longestSliceMicros)
+    _longestSliceMicros = took;
+  _slices++;
+
+  if (_finished)
+    _running = false;
+  return _finished;
+}
+
+void SlicedTask::step()
+{
+  _steps++;
+  if ((_sliceSteps == 0 || _steps < _sliceSteps) && (_sliceMicros == 0 || micros() - _sliceStartMicros < _sliceMicros))
+    return;
+
+  xSemaphoreGive(_yielded);
+  xSemaphoreTake(_resumed, portMAX_DELAY);
+}
+
+void SlicedTask::run(void* self)
+{
+  SlicedTask& t = *(SlicedTask*)self;
+  xSemaphoreTake(t._resumed, portMAX_DELAY);
+
+  t._job(t._context);
+
+  t._finished = true;
+  xSemaphoreGive(t._yielded);
+  vTaskDelete(nullptr);
+}
@@ -0,0 +1,61 @@
+#ifndef SlicedTask_h
+#define SlicedTask_h
+
+#include <stdint.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+/* Runs a long job - a PNG decode - a slice at a time from the loop, on one
+ * core.
+ *
+ * The job gets its own FreeRTOS task and stack, so everything it holds on the
+ * stack survives between slices, but the caller and the job strictly take
+ * turns: resume() hands over and blocks until the job gives control back, so
+ * nothing runs concurrently and no locking is needed. The job calls step()
+ * after each unit of work - a row - and hands back once the slice's rows or
+ * microseconds are used up. A slice therefore overruns by one step at most.
+ */
+class SlicedTask
+{
+  public:
+    typedef void (*job)(void* context);
+
+    SlicedTask();
+    ~SlicedTask();
+
+    // false if the task couldn't be created, when the caller should run the job directly
+    bool start(job j, void* context, const char* name, const uint32_t stackBytes);
+
+    // runs the job until its slice is used up; true once it has finished. 0 rows or microseconds for no limit
+    bool resume(const uint32_t sliceMicros, const uint32_t sliceSteps);
+    void finish()                         { while (_running && !resume(0, 0)) {} }
+
+    // called by the job after each step
+    void step();
+
+    bool isRunning() const                { return _running; }
+    uint32_t slices() const               { return _slices; }
+    uint32_t longestSliceMicros() const   { return _longestSliceMicros; }
+
+  private:
+    static void run(void* self);
+
+    SemaphoreHandle_t _resumed;
+    SemaphoreHandle_t _yielded;
+
+    job _job;
+    void* _context;
+    bool _running;
+    bool _finished;
+
+    uint32_t _sliceStartMicros;
+    uint32_t _sliceMicros;
+    uint32_t _sliceSteps;
+    uint32_t _steps;
+
+    uint32_t _slices;
+    uint32_t _longestSliceMicros;
+};
+
+#endif
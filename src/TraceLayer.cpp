@@ -0,0 +1,119 @@
+#include "TraceLayer.h"
+
+#include <string.h>
+#include <stdio.h>
+
+#include "Traces.h"
+
+#include <LittleFS.h>
+#include <FS.h>
+
+TraceLayer::TraceLayer() : colour(0), visible(true), _count(0)
+{
+  _name[0] = '\0';
+  invalidate();
+}
+
+void TraceLayer::invalidate()
+{
+  for (int s=0; s < s_mapSlots; s++)
+  {
+    _lod[s].clear();
+    _lodMap[s] = nullptr;
+  }
+}
+
+void TraceLayer::setBuiltIn(const char* name, const uint16_t c)
+{
+  _filename.clear();
+  snprintf(_name, sizeof(_name), "%s", name);
+  _count = WraysburyTraces::getAllTraceCount();
+  colour = c;
+  invalidate();
+}
+
+bool TraceLayer::setFile(const char* filename, const uint16_t c)
+{
+  if (filename == nullptr || !LittleFS.exists(filename))
+    return false;
+
+  fs::File f = LittleFS.open(filename, FILE_READ);
+  if (!f)
+    return false;
+
+  // the count is checked against what the file can hold, so it can't overflow the size or _count
+  Header header;
+  const bool ok = (f.size() >= sizeof(header) && f.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                   header.magic == s_magic && header.version == s_version &&
+                   header.count <= (f.size() - sizeof(header)) / (2 * sizeof(int32_t)) && header.count <= (uint32_t)INT32_MAX);
+  f.close();
+
+  if (!ok)
+    return false;
+
+  _filename = filename;
+
+  // name is the file's base name without its extension
+  const char* base = strrchr(filename, '/');
+  base = (base ? base + 1 : filename);
+  snprintf(_name, sizeof(_name), "%s", base);
+  char* dot = strrchr(_name, '.');
+  if (dot)
+    *dot = '\0';
+
+  _count = (int)header.count;
+  colour = c;
+  invalidate();
+  return true;
+}
+
+bool TraceLayer::forEachPoint(const std::function<void(const double, const double)>& visit) const
+{
+  if (isBuiltIn())
+  {
+    for (int i=0; i < _count; i++)
+      visit(WraysburyTraces::all_trace[i]._la, WraysburyTraces::all_trace[i]._lo);
+    return true;
+  }
+
+  fs::File f = LittleFS.open(_filename.c_str(), FILE_READ);
+  if (!f)
+    return false;
+
+  if (!f.seek(sizeof(Header)))
+  {
+    f.close();
+    return false;
+  }
+
+  // a chunk of pairs at a time, so the geo points are never all in RAM
+  int32_t chunk[64][2];
+  int remaining = _count;
+  while (remaining > 0)
+  {
+    const int want = (remaining < 64 ? remaining : 64);
+    const int got = f.read((uint8_t*)chunk, want * sizeof(chunk[0])) / sizeof(chunk[0]);
+
+    for (int i=0; i < got; i++)
+      visit(chunk[i][0] / 1e6, chunk[i][1] / 1e6);
+
+    remaining -= got;
+    if (got < want)
+      break;
+  }
+  f.close();
+
+  return remaining == 0;
+}
+
+TraceLod* TraceLayer::cachedLod(const int slot, const void* map)
+{
+  return (_lodMap[slot] == map ? &_lod[slot] : nullptr);
+}
+
+TraceLod& TraceLayer::resetLod(const int slot, const void* map)
+{
+  _lod[slot].clear();
+  _lodMap[slot] = map;
+  return _lod[slot];
+}
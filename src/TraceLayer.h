@@ -0,0 +1,65 @@
+#ifndef TraceLayer_h
+#define TraceLayer_h
+
+#include <stdint.h>
+#include <functional>
+#include <string>
+
+#include "TraceLod.h"
+
+/* One set of survey traces drawn as a map overlay, with its own colour and
+ * visibility.
+ *
+ * The points come from a LittleFS file - a Header then int32 latitude and
+ * longitude pairs in millionths of a degree - or, where no files are present,
+ * from the compiled-in survey. File points are streamed a chunk at a time
+ * whenever the layer is projected, so only the projected pixels stay resident.
+ * Each layer keeps its own level of detail per map slot (detail map and all
+ * lake), so hiding a layer costs nothing and adding one leaves the others'
+ * caches alone.
+ */
+class TraceLayer
+{
+  public:
+    static const int s_mapSlots = 2;
+    static const uint32_t s_magic = 0x4C435254;    // "TRCL"
+    static const uint16_t s_version = 1;
+
+    struct Header
+    {
+      uint32_t magic;
+      uint16_t version;
+      uint16_t reserved;
+      uint32_t count;
+    };
+
+    TraceLayer();
+
+    void setBuiltIn(const char* name, const uint16_t colour);
+    bool setFile(const char* filename, const uint16_t colour);     // false if the file is missing or malformed
+
+    // calls visit(lat, lng) for each point in order; false if the source couldn't be read
+    bool forEachPoint(const std::function<void(const double, const double)>& visit) const;
+
+    const char* name() const      { return _name; }
+    int pointCount() const        { return _count; }
+    bool isBuiltIn() const        { return _filename.empty(); }
+
+    uint16_t colour;
+    bool visible;
+
+    // the slot's level of detail if it was built for map, else nullptr
+    TraceLod* cachedLod(const int slot, const void* map);
+    TraceLod& resetLod(const int slot, const void* map);
+    void invalidate();
+
+  private:
+    std::string _filename;
+    char _name[24];
+    int _count;
+
+    TraceLod _lod[s_mapSlots];
+    const void* _lodMap[s_mapSlots];
+};
+
+#endif
@@ -0,0 +1,122 @@
+#include "TraceLod.h"
+
+#include <math.h>
+#include <algorithm>
+
+TraceLod::TraceLod() : _width(0), _height(0), _cellPixels(1), _fractionalZoom(0)
+{
+}
+
+void TraceLod::clear()
+{
+  _mapX.clear();
+  _mapY.clear();
+  for (int z=0; z <= s_maxZoom; z++)
+    _levels[z] = Level();
+  _fractionalLevel = Level();
+  _fractionalZoom = 0;
+}
+
+void TraceLod::setMapPoints(const std::vector<float>& mapX, const std::vector<float>& mapY,
+                            const int16_t width, const int16_t height, const int cellPixels)
+{
+  clear();
+  _mapX = mapX;
+  _mapY = mapY;
+  _width = width;
+  _height = height;
+  _cellPixels = std::max(cellPixels, 1);
+}
+
+const TraceLod::Level* TraceLod::findLevel(const uint32_t zoomFixed) const
+{
+  if ((zoomFixed & 0xFFFF) == 0)
+  {
+    const uint32_t zoom = zoomFixed >> 16;
+    return (zoom >= 1 && zoom <= s_maxZoom ? &_levels[zoom] : nullptr);
+  }
+  return (zoomFixed == _fractionalZoom ? &_fractionalLevel : nullptr);
+}
+
+int TraceLod::levelPointCount(const uint32_t zoomFixed) const
+{
+  const Level* level = findLevel(zoomFixed);
+  return (level && level->built ? level->points.size() : 0);
+}
+
+void TraceLod::buildLevel(Level& level, const uint32_t zoomFixed)
+{
+  level = Level();
+
+  // a fractional zoom leaves the last tile across part off the map
+  const int tiles = (zoomFixed + 0xFFFF) >> 16;
+
+  // (tile, cell) keys, so sorting groups by tile and brings duplicates together
+  const int cellsX = (_width + _cellPixels - 1) / _cellPixels;
+  const int cellsY = (_height + _cellPixels - 1) / _cellPixels;
+  const uint32_t cellsPerTile = cellsX * cellsY;
+
+  std::vector<uint32_t> keys;
+  keys.reserve(_mapX.size());
+  for (size_t i=0; i < _mapX.size(); i++)
+  {
+    if (_mapX[i] < 0 || _mapX[i] >= _width || _mapY[i] < 0 || _mapY[i] >= _height)
+      continue;
+
+    const int zx = (int)(_mapX[i] * zoomFixed / 65536.0f);
+    const int zy = (int)(_mapY[i] * zoomFixed / 65536.0f);
+    const int tile = (zy / _height) * tiles + (zx / _width);
+    const int cell = ((zy % _height) / _cellPixels) * cellsX + (zx % _width) / _cellPixels;
+    keys.push_back(tile * cellsPerTile + cell);
+  }
+
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  level.tileStart.assign(tiles * tiles + 1, 0);
+  level.points.resize(keys.size());
+  for (size_t i=0; i < keys.size(); i++)
+  {
+    const int tile = keys[i] / cellsPerTile;
+    const int cell = keys[i] % cellsPerTile;
+
+    // draw at the centre of the cell
+    level.points[i].x = (cell % cellsX) * _cellPixels + _cellPixels / 2;
+    level.points[i].y = (cell / cellsX) * _cellPixels + _cellPixels / 2;
+    level.tileStart[tile + 1]++;
+  }
+
+  for (int t=0; t < tiles * tiles; t++)
+    level.tileStart[t+1] += level.tileStart[t];
+
+  level.built = true;
+}
+
+bool TraceLod::tilePoints(const uint32_t zoomFixed, const int tileX, const int tileY, const Point*& points, int& count)
+{
+  points = nullptr;
+  count = 0;
+
+  if (zoomFixed < 0x10000 || zoomFixed > ((uint32_t)s_maxZoom << 16) || _mapX.empty())
+    return false;
+
+  // the one fractional level follows whichever fractional zoom is asked for
+  if ((zoomFixed & 0xFFFF) != 0 && zoomFixed != _fractionalZoom)
+  {
+    _fractionalZoom = zoomFixed;
+    _fractionalLevel = Level();
+  }
+
+  Level& level = ((zoomFixed & 0xFFFF) != 0 ? _fractionalLevel : _levels[zoomFixed >> 16]);
+  if (!level.built)
+    buildLevel(level, zoomFixed);
+
+  const int tiles = (zoomFixed + 0xFFFF) >> 16;
+  if (tileX < 0 || tileX >= tiles || tileY < 0 || tileY >= tiles)
+    return true;
+
+  const int tile = tileY * tiles + tileX;
+  points = level.points.data() + level.tileStart[tile];
+  count = level.tileStart[tile+1] - level.tileStart[tile];
+  return true;
+}
@@ -0,0 +1,64 @@
+#ifndef TraceLod_h
+#define TraceLod_h
+
+#include <stdint.h>
+#include <vector>
+
+/* Per-zoom level of detail for a point overlay such as the dive traces.
+ *
+ * Holds each point's fractional map pixel for one map. The level for a zoom is
+ * built on first use: points are quantised to a grid of cellPixels zoomed
+ * pixels, duplicates dropped so nothing is drawn twice, and the survivors
+ * bucketed by tile. Drawing a tile then walks only the distinct points on
+ * screen, however many trace points share those pixels.
+ *
+ * Zooms are 16.16 fixed point, as ZoomScale. Each whole zoom keeps its level;
+ * one level between them is kept too, rebuilt when that zoom changes.
+ */
+class TraceLod
+{
+  public:
+    static const int s_maxZoom = 4;
+
+    class Point
+    {
+      public:
+        int16_t x;      // within the tile
+        int16_t y;
+    };
+
+    TraceLod();
+
+    void setMapPoints(const std::vector<float>& mapX, const std::vector<float>& mapY,
+                      const int16_t width, const int16_t height, const int cellPixels);
+    void clear();
+
+    // points on one tile at a 16.16 zoom, in tile pixels; false if that zoom can't be built
+    bool tilePoints(const uint32_t zoomFixed, const int tileX, const int tileY, const Point*& points, int& count);
+
+    int levelPointCount(const uint32_t zoomFixed) const;
+    int sourcePointCount() const    { return _mapX.size(); }
+
+  private:
+    class Level
+    {
+      public:
+        bool built = false;
+        std::vector<Point> points;          // grouped by tile, row-major
+        std::vector<uint32_t> tileStart;    // tiles*tiles+1 offsets into points; a level can pass 65535 points
+    };
+
+    const Level* findLevel(const uint32_t zoomFixed) const;
+    void buildLevel(Level& level, const uint32_t zoomFixed);
+
+    std::vector<float> _mapX;
+    std::vector<float> _mapY;
+    int16_t _width;
+    int16_t _height;
+    int _cellPixels;
+    Level _levels[s_maxZoom + 1];
+    Level _fractionalLevel;
+    uint32_t _fractionalZoom;
+};
+
+#endif
@@ -0,0 +1,164 @@
+#include "TrailPolyline.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+
+#include "TFT_eSPI.h"
+#include "AffineBlit.h"
+
+TrailPolyline::TrailPolyline() : _minSpacing(2), _lastRunsDrawn(0)
+{
+}
+
+void TrailPolyline::clear(const int16_t minSpacing)
+{
+  _vertices.clear();
+  _runs.clear();
+  _minSpacing = minSpacing;
+  _lastRunsDrawn = 0;
+}
+
+void TrailPolyline::extendRun(Run& run, const Vertex& v)
+{
+  run.minX = std::min(run.minX, v.x);  run.maxX = std::max(run.maxX, v.x);
+  run.minY = std::min(run.minY, v.y);  run.maxY = std::max(run.maxY, v.y);
+}
+
+float TrailPolyline::pathLengthTo(const int index) const
+{
+  const int first = index - index % s_runVertices;
+  float length = _runs[index / s_runVertices].startLength;
+  for (int i=first+1; i <= index; i++)
+    length += hypotf(_vertices[i].x - _vertices[i-1].x, _vertices[i].y - _vertices[i-1].y);
+  return length;
+}
+
+void TrailPolyline::add(const int16_t x, const int16_t y)
+{
+  Vertex v;
+  v.x = x;
+  v.y = y;
+
+  const int n = _vertices.size();
+
+  // the end of the line is provisional until it is clear of the vertex before: until then move it rather than add one
+  if (n >= 2 && abs(_vertices[n-1].x - _vertices[n-2].x) < _minSpacing && abs(_vertices[n-1].y - _vertices[n-2].y) < _minSpacing)
+  {
+    _vertices[n-1] = v;
+    extendRun(_runs.back(), v);
+
+    if ((n-1) % s_runVertices == 0)
+    {
+      // it starts the last run, so it also ends the segment drawn by the run before
+      Run& previous = _runs[_runs.size()-2];
+      extendRun(previous, v);
+      _runs.back().startLength = pathLengthTo(n-2) + hypotf(x - _vertices[n-2].x, y - _vertices[n-2].y);
+    }
+    return;
+  }
+
+  if (n == 1 && _vertices[0].x == x && _vertices[0].y == y)
+    return;
+
+  if (n % s_runVertices == 0)
+  {
+    Run run;
+    run.minX = run.maxX = x;
+    run.minY = run.maxY = y;
+    run.startLength = 0;
+
+    if (n > 0)
+    {
+      // the previous run draws the segment joining it to this one
+      extendRun(_runs.back(), v);
+      run.startLength = pathLengthTo(n-1) + hypotf(x - _vertices[n-1].x, y - _vertices[n-1].y);
+    }
+
+    _runs.push_back(run);
+  }
+  else
+  {
+    extendRun(_runs.back(), v);
+  }
+
+  _vertices.push_back(v);
+}
+
+void TrailPolyline::drawArrow(TFT_eSprite& sprite, const float x, const float y, const float dx, const float dy,
+                              const int length, const uint16_t colour)
+{
+  // chevron pointing along (dx,dy), arms swept back 30 degrees either side
+  const float c = 0.866f * length;
+  const float s = 0.5f * length;
+  sprite.drawLine(x, y, x - c*dx + s*dy, y - c*dy - s*dx, colour);
+  sprite.drawLine(x, y, x - c*dx - s*dy, y - c*dy + s*dx, colour);
+}
+
+void TrailPolyline::draw(TFT_eSprite& sprite, const int16_t originX, const int16_t originY, const int16_t width, const int16_t height,
+                         const uint16_t colour, const int arrowSpacing, const int arrowLength, const AffineBlit* rotation,
+                         const int newestRuns)
+{
+  _lastRunsDrawn = 0;
+
+  // runs are culled against the unrotated tile; only what's drawn goes through the rotation
+  auto place = [&](const float x, const float y, float& screenX, float& screenY)
+  {
+    if (rotation)
+      rotation->toScreen(x - originX, y - originY, screenX, screenY);
+    else
+    {
+      screenX = x - originX;
+      screenY = y - originY;
+    }
+  };
+
+  const int n = _vertices.size();
+  if (n == 1)
+  {
+    float x, y;
+    place(_vertices[0].x, _vertices[0].y, x, y);
+    sprite.drawPixel(x, y, colour);
+    return;
+  }
+
+  const size_t firstRun = (newestRuns > 0 && (int)_runs.size() > newestRuns ? _runs.size() - newestRuns : 0);
+  for (size_t r=firstRun; r < _runs.size(); r++)
+  {
+    const Run& run = _runs[r];
+    if (run.maxX + arrowLength < originX || run.minX - arrowLength >= originX + width ||
+        run.maxY + arrowLength < originY || run.minY - arrowLength >= originY + height)
+      continue;
+
+    _lastRunsDrawn++;
+
+    const int first = r * s_runVertices;
+    const int last = std::min(first + s_runVertices, n - 1);
+
+    float length = run.startLength;
+    for (int i=first; i < last; i++)
+    {
+      const Vertex& a = _vertices[i];
+      const Vertex& b = _vertices[i+1];
+      float ax, ay, bx, by;
+      place(a.x, a.y, ax, ay);
+      place(b.x, b.y, bx, by);
+      sprite.drawLine(ax, ay, bx, by, colour);
+
+      const float segment = hypotf(b.x - a.x, b.y - a.y);
+      if (arrowSpacing > 0 && segment > 0)
+      {
+        // an arrow wherever the path length passes a multiple of the spacing
+        // a rotation keeps lengths, so the direction on screen is just the segment's ends as drawn
+        const float dx = (bx - ax) / segment;
+        const float dy = (by - ay) / segment;
+        for (float at = ceilf(length / arrowSpacing) * arrowSpacing; at < length + segment; at += arrowSpacing)
+        {
+          const float t = at - length;
+          drawArrow(sprite, ax + dx * t, ay + dy * t, dx, dy, arrowLength, colour);
+        }
+      }
+      length += segment;
+    }
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef TrailPolyline_h
+#define TrailPolyline_h
+
+#include <stdint.h>
+#include <vector>
+
+class TFT_eSprite;
+class AffineBlit;
+
+/* A trail simplified in screen space, for drawing as a connected line.
+ *
+ * Vertices are in zoomed map pixels (map pixel * zoom), so one polyline serves
+ * every tile at a zoom. add() keeps no vertex within the minimum spacing of the
+ * one before, but the newest point always ends the line. Vertices are
+ * grouped in runs of s_runVertices with a bounding box, so draw() skips runs off
+ * the tile and its cost follows the path on screen, not the number of crumbs.
+ * Direction chevrons go every arrowSpacing pixels of path length, measured from
+ * the start of the trail so they don't shift as the diver moves between tiles.
+ * Given a rotation, lines and chevrons are turned with the heading-up map.
+ */
+class TrailPolyline
+{
+  public:
+    static const int s_runVertices = 32;
+
+    TrailPolyline();
+
+    void clear(const int16_t minSpacing);
+    void add(const int16_t x, const int16_t y);
+
+    int vertexCount() const       { return _vertices.size(); }
+    int lastRunsDrawn() const     { return _lastRunsDrawn; }
+
+    void draw(TFT_eSprite& sprite, const int16_t originX, const int16_t originY, const int16_t width, const int16_t height,
+              const uint16_t colour, const int arrowSpacing, const int arrowLength, const AffineBlit* rotation = nullptr,
+              const int newestRuns = 0);      // 0 for the whole trail, else just the newest runs
+
+  private:
+    class Vertex
+    {
+      public:
+        int16_t x;
+        int16_t y;
+    };
+
+    class Run
+    {
+      public:
+        int16_t minX, minY, maxX, maxY;
+        float startLength;      // path length to the run's first vertex
+    };
+
+    void extendRun(Run& run, const Vertex& v);
+    float pathLengthTo(const int index) const;
+    void drawArrow(TFT_eSprite& sprite, const float x, const float y, const float dx, const float dy, const int length, const uint16_t colour);
+
+    std::vector<Vertex> _vertices;
+    std::vector<Run> _runs;
+    int16_t _minSpacing;
+    int _lastRunsDrawn;
+};
+
+#endif
@@ -0,0 +1,212 @@
+#include "WaypointGrid.h"
+
+#include <math.h>
+#include <algorithm>
+
+#include "NavigationWaypoints.h"
+
+// Planar distance is within 1% of the exact distance (plus a metre of slack) at dive-site scale.
+// Used only to prune; anything that might win is scored exactly.
+static const double s_pruneScale = 0.99;
+static const double s_pruneSlackMetres = 1.0;
+
+static const int s_maxCells = 4096;
+static const float s_minCellSize = 5.0f;
+static const float s_targetEntriesPerCell = 2.0f;
+
+WaypointGrid::WaypointGrid() : _waypoints(nullptr),
+                               _exactDistance(nullptr),
+                               _minE(0),
+                               _minN(0),
+                               _cellSize(0),
+                               _cols(0),
+                               _rows(0),
+                               _lastCellsVisited(0),
+                               _lastExactEvaluations(0)
+{
+}
+
+void WaypointGrid::clear()
+{
+  _waypoints = nullptr;
+  _cellStart.clear();
+  _entries.clear();
+  _cols = _rows = 0;
+}
+
+void WaypointGrid::build(const SiteFrame& frame, const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex, ExactDistanceFn exactDistance)
+{
+  std::vector<int> indices;
+  for (int i=firstIndex; i < endIndex; i++)
+    indices.push_back(i);
+
+  _frame = frame;
+  _waypoints = waypoints;
+  _exactDistance = exactDistance;
+  buildFromIndices(indices);
+}
+
+void WaypointGrid::build(const SiteFrame& frame, const NavigationWaypoint* waypoints, const int* indices, const int count, ExactDistanceFn exactDistance)
+{
+  _frame = frame;
+  _waypoints = waypoints;
+  _exactDistance = exactDistance;
+  buildFromIndices(std::vector<int>(indices, indices + std::max(count,0)));
+}
+
+void WaypointGrid::buildFromIndices(const std::vector<int>& indices)
+{
+  _cellStart.clear();
+  _entries.clear();
+  _cols = _rows = 0;
+
+  if (indices.empty() || _waypoints == nullptr || !_frame.isSet())
+    return;
+
+  std::vector<Entry> entries(indices.size());
+  float minE = 1e30f, minN = 1e30f, maxE = -1e30f, maxN = -1e30f;
+  for (size_t k=0; k < indices.size(); k++)
+  {
+    const NavigationWaypoint& wp = _waypoints[indices[k]];
+    Entry& entry = entries[k];
+    const SiteFrame::point local = _frame.toLocal(wp._lat, wp._long);
+    entry.e = local.e;
+    entry.n = local.n;
+    entry.index = (int16_t)indices[k];
+    entry.category = (uint8_t)wp._cat;
+    minE = std::min(minE, entry.e);  maxE = std::max(maxE, entry.e);
+    minN = std::min(minN, entry.n);  maxN = std::max(maxN, entry.n);
+  }
+
+  // size cells for a couple of waypoints each, bounded so the offset table stays small
+  const float width = std::max(maxE - minE, 1.0f);
+  const float height = std::max(maxN - minN, 1.0f);
+  _cellSize = std::max(s_minCellSize, sqrtf(width * height * s_targetEntriesPerCell / entries.size()));
+  while ((int)(width / _cellSize + 1) * (int)(height / _cellSize + 1) > s_maxCells)
+    _cellSize *= 1.5f;
+
+  _minE = minE;
+  _minN = minN;
+  _cols = (int16_t)(width / _cellSize) + 1;
+  _rows = (int16_t)(height / _cellSize) + 1;
+
+  // counting sort into cells, stable so each cell stays in waypoint index order
+  std::vector<int> cellOf(entries.size());
+  _cellStart.assign(_cols * _rows + 1, 0);
+  for (size_t k=0; k < entries.size(); k++)
+  {
+    const int cx = std::min((int)((entries[k].e - _minE) / _cellSize), _cols - 1);
+    const int cy = std::min((int)((entries[k].n - _minN) / _cellSize), _rows - 1);
+    cellOf[k] = cy * _cols + cx;
+    _cellStart[cellOf[k] + 1]++;
+  }
+
+  for (int c=0; c < _cols * _rows; c++)
+    _cellStart[c+1] += _cellStart[c];
+
+  std::vector<uint16_t> fill(_cellStart.begin(), _cellStart.end() - 1);
+  _entries.resize(entries.size());
+  for (size_t k=0; k < entries.size(); k++)
+    _entries[fill[cellOf[k]]++] = entries[k];
+}
+
+int WaypointGrid::nearest(const double lat, const double lng, double& distance,
+                          const uint16_t categoryMask, double* secondDistance) const
+{
+  int bestIndex = -1;
+  double bestDistance = 1e99;
+  double runnerUpDistance = 1e99;
+
+  _lastCellsVisited = 0;
+  _lastExactEvaluations = 0;
+
+  if (!isBuilt())
+  {
+    distance = bestDistance;
+    if (secondDistance)
+      *secondDistance = runnerUpDistance;
+    return bestIndex;
+  }
+
+  const SiteFrame::point local = _frame.toLocal(lat, lng);
+  const float e = local.e;
+  const float n = local.n;
+
+  const int cx = (int)floorf((e - _minE) / _cellSize);
+  const int cy = (int)floorf((n - _minN) / _cellSize);
+
+  // diver offset within its own cell, used for a tight lower bound on each ring
+  const float fx = e - (_minE + cx * _cellSize);
+  const float fy = n - (_minN + cy * _cellSize);
+
+  const int maxRing = std::max(std::max(abs(cx), abs(_cols - 1 - cx)), std::max(abs(cy), abs(_rows - 1 - cy)));
+
+  // a diver off the grid - at home, or on a 0,0 fix - starts at the first ring to reach it, and only the part of
+  // each ring on the grid is walked, so the cost stays bounded by the grid rather than the distance to it
+  const int firstRing = std::max(std::max(-cx, cx - (_cols - 1)), std::max(std::max(-cy, cy - (_rows - 1)), 0));
+
+  for (int r=firstRing; r <= maxRing; r++)
+  {
+    const double bound = (secondDistance ? runnerUpDistance : bestDistance);
+
+    if (r > 0)
+    {
+      const float ringNearest = std::min(std::min(r * _cellSize - fx, fx + (r - 1) * _cellSize),
+                                         std::min(r * _cellSize - fy, fy + (r - 1) * _cellSize));
+      if (ringNearest * s_pruneScale - s_pruneSlackMetres > bound)
+        break;
+    }
+
+    const int yEnd = std::min(cy + r, _rows - 1);
+    for (int y = std::max(cy - r, 0); y <= yEnd; y++)
+    {
+      // full row on the top and bottom edges of the ring, just the two end cells otherwise
+      const bool edgeRow = (y == cy - r || y == cy + r);
+      const int xStep = edgeRow ? 1 : std::max(2 * r, 1);
+      const int xStart = (edgeRow ? std::max(cx - r, 0) : cx - r);
+      const int xEnd = (edgeRow ? std::min(cx + r, _cols - 1) : cx + r);
+
+      for (int x = xStart; x <= xEnd; x += xStep)
+      {
+        if (x < 0 || x >= _cols)
+          continue;
+
+        _lastCellsVisited++;
+
+        const int cell = y * _cols + x;
+        for (int k = _cellStart[cell]; k < _cellStart[cell+1]; k++)
+        {
+          const Entry& entry = _entries[k];
+          if ((categoryBit(entry.category) & categoryMask) == 0)
+            continue;
+
+          const double limit = (secondDistance ? runnerUpDistance : bestDistance);
+          const float planar = hypotf(entry.e - e, entry.n - n);
+          if (planar * s_pruneScale - s_pruneSlackMetres > limit)
+            continue;
+
+          const NavigationWaypoint& wp = _waypoints[entry.index];
+          const double d = _exactDistance(lat, lng, wp._lat, wp._long);
+          _lastExactEvaluations++;
+
+          if (d < bestDistance || (d == bestDistance && entry.index < bestIndex))
+          {
+            runnerUpDistance = bestDistance;
+            bestDistance = d;
+            bestIndex = entry.index;
+          }
+          else if (d < runnerUpDistance)
+          {
+            runnerUpDistance = d;
+          }
+        }
+      }
+    }
+  }
+
+  distance = bestDistance;
+  if (secondDistance)
+    *secondDistance = runnerUpDistance;
+
+  return bestIndex;
+}
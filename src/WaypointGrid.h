@@ -0,0 +1,81 @@
+#ifndef WaypointGrid_h
+#define WaypointGrid_h
+
+#include <stdint.h>
+#include <vector>
+
+#include "SiteFrame.h"
+
+class NavigationWaypoint;
+
+/* Uniform grid over a fixed set of waypoints, in site-local metres.
+ *
+ * Built once per site from either a contiguous waypoint range or an explicit
+ * list of indices (e.g. the exit waypoints). Nearest queries walk square rings
+ * of cells outward from the diver's cell and stop as soon as no unvisited cell
+ * can hold anything closer than the current winner, so per-frame cost depends
+ * on local waypoint density rather than table size.
+ *
+ * The planar distance is only used to prune - every surviving candidate is
+ * scored with the supplied exact distance function, and ties resolve to the
+ * lowest waypoint index, so the winner is identical to a linear scan.
+ */
+class WaypointGrid
+{
+  public:
+    typedef double (*ExactDistanceFn)(double lat1, double long1, double lat2, double long2);
+
+    static const uint16_t allCategories = 0xFFFF;
+
+    static uint16_t categoryBit(const int category) { return (uint16_t)(1u << category); }
+
+    WaypointGrid();
+
+    void build(const SiteFrame& frame, const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex, ExactDistanceFn exactDistance);
+    void build(const SiteFrame& frame, const NavigationWaypoint* waypoints, const int* indices, const int count, ExactDistanceFn exactDistance);
+    void clear();
+
+    bool isBuilt() const    { return _waypoints != nullptr && !_entries.empty(); }
+    int  size() const       { return (int)_entries.size(); }
+
+    const NavigationWaypoint* waypoints() const  { return _waypoints; }
+
+    // Returns the waypoint index closest to lat/lng (or -1 if none match the category mask)
+    // and sets distance to the exact distance in metres. If secondDistance is given it is set
+    // to the exact distance of the runner-up (1e99 if there is none).
+    int nearest(const double lat, const double lng, double& distance,
+                const uint16_t categoryMask = allCategories, double* secondDistance = nullptr) const;
+
+    // diagnostics: cells visited and exact distances computed by the last query
+    uint16_t lastCellsVisited() const     { return _lastCellsVisited; }
+    uint16_t lastExactEvaluations() const { return _lastExactEvaluations; }
+
+  private:
+    struct Entry
+    {
+      float e;
+      float n;
+      int16_t index;
+      uint8_t category;
+    };
+
+    void buildFromIndices(const std::vector<int>& indices);
+
+    const NavigationWaypoint* _waypoints;
+    ExactDistanceFn _exactDistance;
+    SiteFrame _frame;
+
+    float _minE;
+    float _minN;
+    float _cellSize;
+    int16_t _cols;
+    int16_t _rows;
+
+    std::vector<uint16_t> _cellStart;     // _cols*_rows+1 offsets into _entries
+    std::vector<Entry> _entries;          // sorted by cell, then by waypoint index
+
+    mutable uint16_t _lastCellsVisited;
+    mutable uint16_t _lastExactEvaluations;
+};
+
+#endif
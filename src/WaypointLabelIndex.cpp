@@ -0,0 +1,101 @@
+#include "WaypointLabelIndex.h"
+
+#include <string.h>
+#include <algorithm>
+
+#include "NavigationWaypoints.h"
+
+WaypointLabelIndex::WaypointLabelIndex() : _capacity(0), _count(0)
+{
+}
+
+// copy up to s_keyLength chars, padding after the terminator so memcmp behaves like strncmp
+void WaypointLabelIndex::makeKey(const char* label, char* key, int& length)
+{
+  length = 0;
+  while (length < s_keyLength && label[length] != '\0')
+  {
+    key[length] = label[length];
+    length++;
+  }
+
+  for (int i=length; i < s_keyLength; i++)
+    key[i] = '\0';
+}
+
+void WaypointLabelIndex::build(const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex)
+{
+  const int count = std::max(endIndex - firstIndex, 0);
+
+  if (count > _capacity)
+  {
+    _entries.reset(new Entry[count]);
+    _capacity = count;
+  }
+
+  _count = count;
+
+  int length;
+  for (int i=0; i < count; i++)
+  {
+    makeKey(waypoints[firstIndex + i]._label, _entries[i].key, length);
+    _entries[i].index = (int16_t)(firstIndex + i);
+  }
+
+  std::sort(_entries.get(), _entries.get() + _count, [](const Entry& a, const Entry& b)
+  {
+    const int c = memcmp(a.key, b.key, s_keyLength);
+    return (c != 0 ? c < 0 : a.index < b.index);
+  });
+}
+
+// first entry whose key is not less than the first length chars of key
+int WaypointLabelIndex::lowerBound(const char* key, const int length) const
+{
+  int lo = 0, hi = _count;
+  while (lo < hi)
+  {
+    const int mid = (lo + hi) / 2;
+    if (memcmp(_entries[mid].key, key, length) < 0)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+int WaypointLabelIndex::findExact(const char* label) const
+{
+  if (label == nullptr)
+    return -1;
+
+  char key[s_keyLength];
+  int length;
+  makeKey(label, key, length);
+
+  const int k = lowerBound(key, s_keyLength);
+  if (k < _count && memcmp(_entries[k].key, key, s_keyLength) == 0)
+    return _entries[k].index;
+
+  return -1;
+}
+
+int WaypointLabelIndex::findPrefix(const char* prefix, int* indices, const int maxIndices) const
+{
+  if (prefix == nullptr)
+    return 0;
+
+  char key[s_keyLength];
+  int length;
+  makeKey(prefix, key, length);
+
+  int matches = 0;
+  for (int k = lowerBound(key, length); k < _count && memcmp(_entries[k].key, key, length) == 0; k++)
+  {
+    if (matches < maxIndices)
+      indices[matches] = _entries[k].index;
+    matches++;
+  }
+
+  return matches;
+}
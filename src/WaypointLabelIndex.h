@@ -0,0 +1,50 @@
+#ifndef WaypointLabelIndex_h
+#define WaypointLabelIndex_h
+
+#include <stdint.h>
+#include <memory>
+
+class NavigationWaypoint;
+
+/* Sorted index over the first 3 characters of each waypoint label.
+ *
+ * Lookups are a binary search instead of a strncmp scan of the waypoint table.
+ * Keys compare exactly as strncmp(label, key, 3) does, and equal keys keep
+ * waypoint index order, so findExact returns the same waypoint as the scan.
+ * Storage is allocated when the index is built and only grows if a later site
+ * has more waypoints; lookups never allocate.
+ */
+class WaypointLabelIndex
+{
+  public:
+    static const int s_keyLength = 3;
+
+    WaypointLabelIndex();
+
+    void build(const NavigationWaypoint* waypoints, const int firstIndex, const int endIndex);
+
+    // waypoint index whose label matches the first 3 chars of label, or -1
+    int findExact(const char* label) const;
+
+    // waypoint indices whose label starts with prefix (up to 3 chars), in label then index order.
+    // Returns the number of matches, of which at most maxIndices are written.
+    int findPrefix(const char* prefix, int* indices, const int maxIndices) const;
+
+    int size() const { return _count; }
+
+  private:
+    struct Entry
+    {
+      char key[s_keyLength];
+      int16_t index;
+    };
+
+    static void makeKey(const char* label, char* key, int& length);
+    int lowerBound(const char* key, const int length) const;
+
+    std::unique_ptr<Entry[]> _entries;
+    int _capacity;
+    int _count;
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include "ZoomScale.h"
+
+#include <algorithm>
+
+ZoomScale::ZoomScale() : _fixed(s_one), _width(0), _height(0)
+{
+}
+
+void ZoomScale::buildTable(std::vector<uint16_t>& table, const int16_t length)
+{
+  // exact m / zoom, so an integer zoom picks the same source pixels as integer division
+  table.resize(zoomed(length));
+  for (size_t m=0; m < table.size(); m++)
+    table[m] = ((uint64_t)m << 16) / _fixed;
+}
+
+void ZoomScale::set(const uint32_t zoomFixed, const int16_t width, const int16_t height)
+{
+  if (zoomFixed == _fixed && width == _width && height == _height)
+    return;
+
+  _fixed = std::max(zoomFixed, s_one);
+  _width = width;
+  _height = height;
+  buildTable(_columns, width);
+  buildTable(_rows, height);
+}
+
+void ZoomScale::scaleRect(uint16_t* dest, const uint16_t* source, const int32_t originX, const int32_t originY,
+                          const int16_t w, const int16_t h, const bool swapBytes, const int16_t destStride) const
+{
+  if (dest == nullptr || source == nullptr || originX < 0 || originY < 0)
+    return;
+
+  const int32_t columns = std::min<int32_t>(w, zoomedWidth() - originX);
+  const int32_t rows = std::min<int32_t>(h, zoomedHeight() - originY);
+  const uint16_t* columnTable = _columns.data() + originX;
+
+  for (int32_t sy = 0; sy < rows; sy++)
+  {
+    const uint16_t* sourceRow = source + (size_t)_rows[originY + sy] * _width;
+    uint16_t* destRow = dest + (size_t)sy * (destStride > w ? destStride : w);
+
+    if (swapBytes)
+    {
+      for (int32_t sx = 0; sx < columns; sx++)
+      {
+        const uint16_t c = sourceRow[columnTable[sx]];
+        destRow[sx] = (c >> 8) | (c << 8);
+      }
+    }
+    else
+    {
+      for (int32_t sx = 0; sx < columns; sx++)
+        destRow[sx] = sourceRow[columnTable[sx]];
+    }
+  }
+}
@@ -0,0 +1,54 @@
+#ifndef ZoomScale_h
+#define ZoomScale_h
+
+#include <stdint.h>
+#include <vector>
+
+/* Map zoom as a 16.16 fixed-point factor, so views can sit between the integer
+ * zooms (1.5x, 2.5x) with no floating point per pixel.
+ *
+ * zoomed() takes an unzoomed map pixel to zoomed map pixels, for the tile maths
+ * and every overlay. For the image, set() builds a table per axis of the source
+ * pixel under each zoomed pixel; it does so only when the zoom changes, so
+ * scaling then costs a table read per pixel whatever the factor. Scaling is
+ * nearest neighbour, like pushImageScaled.
+ */
+class ZoomScale
+{
+  public:
+    static const uint32_t s_one = 1UL << 16;
+
+    ZoomScale();
+
+    // width x height is the unzoomed image; a no-op unless something changed
+    void set(const uint32_t zoomFixed, const int16_t width, const int16_t height);
+
+    uint32_t fixed() const          { return _fixed; }
+    float value() const             { return _fixed / (float)s_one; }
+    bool isInteger() const          { return (_fixed & (s_one - 1)) == 0; }
+    int tilesAcross() const         { return (_fixed + s_one - 1) >> 16; }
+
+    int32_t zoomed(const int32_t mapPixel) const  { return ((int64_t)mapPixel * _fixed) >> 16; }
+    int32_t zoomedWidth() const     { return _columns.size(); }
+    int32_t zoomedHeight() const    { return _rows.size(); }
+
+    // source pixel under a zoomed map pixel, 0 <= x < zoomedWidth()
+    uint16_t sourceColumn(const int32_t x) const  { return _columns[x]; }
+    uint16_t sourceRow(const int32_t y) const     { return _rows[y]; }
+
+    // scales the part of the zoomed image at origin that lies on the map into a w x h buffer; the rest is left alone.
+    // destStride is dest's row length if wider than w
+    void scaleRect(uint16_t* dest, const uint16_t* source, const int32_t originX, const int32_t originY,
+                   const int16_t w, const int16_t h, const bool swapBytes, const int16_t destStride = 0) const;
+
+  private:
+    void buildTable(std::vector<uint16_t>& table, const int16_t length);
+
+    uint32_t _fixed;
+    int16_t _width;
+    int16_t _height;
+    std::vector<uint16_t> _columns;
+    std::vector<uint16_t> _rows;
+};
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+/* Just enough of the Arduino core for the host unit tests (pio test -e native). */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <math.h>
+#include <chrono>
+
+typedef uint8_t byte;
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define radians(deg) ((deg)*DEG_TO_RAD)
+#define degrees(rad) ((rad)*RAD_TO_DEG)
+#define sq(x) ((x)*(x))
+
+inline uint32_t micros()
+{
+  static const auto start = std::chrono::steady_clock::now();
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline uint32_t millis()    { return micros() / 1000; }
+
+class Print
+{
+  public:
+    size_t printf(const char* format, ...)
+    {
+      if (!_echo)
+        return 0;
+      va_list args;
+      va_start(args, format);
+      const int n = vprintf(format, args);
+      va_end(args);
+      return n;
+    }
+    size_t println(const char* s = "")    { return printf("%s\n", s); }
+    size_t print(const char* s)           { return printf("%s", s); }
+    size_t write(const uint8_t* p, size_t n)  { return fwrite(p, 1, n, stdout); }
+
+    bool _echo = false;     // quiet unless a test wants the log
+};
+
+inline Print Serial;
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef FS_h
+#define FS_h
+
+/* In-memory stand-in for the Arduino FS API, for the host unit tests. Files
+ * are byte strings in a map, shared with every open handle. */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+  enum SeekMode { SeekSet, SeekCur, SeekEnd };
+
+  class File
+  {
+    public:
+      File() : _position(0), _writable(false) {}
+      File(const std::string& name, std::shared_ptr<std::string> data, const bool writable, const bool append) :
+        _name(name), _data(data), _position(append ? data->size() : 0), _writable(writable) {}
+
+      operator bool() const   { return (bool)_data; }
+      void close()            { _data.reset(); }
+      void flush()            {}
+
+      size_t size() const     { return _data ? _data->size() : 0; }
+      size_t position() const { return _position; }
+      int available()         { return _data ? (int)(_data->size() - _position) : 0; }
+      const char* name() const  { return _name.c_str(); }
+      bool isDirectory()      { return false; }
+
+      bool seek(uint32_t pos, SeekMode mode = SeekSet)
+      {
+        if (!_data)
+          return false;
+        const size_t base = (mode == SeekSet ? 0 : mode == SeekCur ? _position : _data->size());
+        if (base + pos > _data->size())
+          return false;
+        _position = base + pos;
+        return true;
+      }
+
+      size_t read(uint8_t* buffer, size_t length)
+      {
+        if (!_data || _position >= _data->size())
+          return 0;
+        const size_t n = std::min(length, _data->size() - _position);
+        memcpy(buffer, _data->data() + _position, n);
+        _position += n;
+        return n;
+      }
+
+      int read()
+      {
+        uint8_t c;
+        return (read(&c, 1) == 1 ? c : -1);
+      }
+
+      size_t write(const uint8_t* buffer, size_t length)
+      {
+        if (!_data || !_writable)
+          return 0;
+        if (_position + length > _data->size())
+          _data->resize(_position + length);
+        memcpy(&(*_data)[_position], buffer, length);
+        _position += length;
+        return length;
+      }
+
+      size_t write(uint8_t c)   { return write(&c, 1); }
+
+    private:
+      std::string _name;
+      std::shared_ptr<std::string> _data;
+      size_t _position;
+      bool _writable;
+  };
+
+  class FS
+  {
+    public:
+      File open(const char* path, const char* mode = FILE_READ, bool create = false)
+      {
+        auto it = _files.find(path);
+        if (mode[0] == 'r')
+          return (it == _files.end() ? File() : File(path, it->second, false, false));
+
+        if (it == _files.end() || mode[0] == 'w')
+          it = _files.insert_or_assign(path, std::make_shared<std::string>()).first;
+        return File(path, it->second, true, mode[0] == 'a');
+      }
+
+      bool exists(const char* path)   { return _files.count(path) > 0; }
+      bool remove(const char* path)   { return _files.erase(path) > 0; }
+      bool mkdir(const char* path)    { return true; }
+
+      bool rename(const char* from, const char* to)
+      {
+        auto it = _files.find(from);
+        if (it == _files.end())
+          return false;
+        _files[to] = it->second;
+        _files.erase(from);
+        return true;
+      }
+
+      void format()                   { _files.clear(); }
+
+    private:
+      std::map<std::string, std::shared_ptr<std::string>> _files;
+  };
+}
+
+#endif
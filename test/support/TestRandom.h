@@ -0,0 +1,29 @@
+#ifndef TestRandom_h
+#define TestRandom_h
+
+#include <stdint.h>
+
+/* Repeatable random numbers for the host tests, the same sequence on every
+ * platform rather than whatever its rand() gives. */
+class TestRandom
+{
+  public:
+    explicit TestRandom(const uint32_t seed = 12345) : _seed(seed) {}
+
+    void seed(const uint32_t s)   { _seed = s; }
+
+    // 0 up to 1
+    double unit()
+    {
+      _seed = _seed * 1664525u + 1013904223u;
+      return (_seed >> 8) / 16777216.0;
+    }
+
+    // -1 up to 1
+    double signedUnit()           { return unit() * 2.0 - 1.0; }
+
+  private:
+    uint32_t _seed;
+};
+
+#endif
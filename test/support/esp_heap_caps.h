@@ -0,0 +1,15 @@
+#ifndef esp_heap_caps_h
+#define esp_heap_caps_h
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_SPIRAM 1
+#define MALLOC_CAP_8BIT 2
+#define MALLOC_CAP_INTERNAL 4
+#define MALLOC_CAP_DEFAULT 8
+
+inline void* heap_caps_malloc(size_t bytes, uint32_t caps)  { return malloc(bytes); }
+inline void heap_caps_free(void* p)                         { free(p); }
+
+#endif
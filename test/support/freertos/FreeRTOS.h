@@ -0,0 +1,23 @@
+#ifndef FreeRTOS_h
+#define FreeRTOS_h
+
+/* Host stand-in for the few FreeRTOS calls SlicedTask makes, for the host unit
+ * tests: a task is a detached std::thread and a binary semaphore a flag under
+ * a mutex. */
+
+#include <stdint.h>
+
+typedef void* TaskHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdPASS 1
+#define pdFAIL 0
+#define pdTRUE 1
+#define pdFALSE 0
+
+#endif
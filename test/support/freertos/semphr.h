@@ -0,0 +1,41 @@
+#ifndef semphr_h
+#define semphr_h
+
+#include <condition_variable>
+#include <mutex>
+
+#include "FreeRTOS.h"
+
+namespace freertos_host
+{
+  class BinarySemaphore
+  {
+    public:
+      void give()
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _given = true;
+        _changed.notify_one();
+      }
+
+      // the tests only wait forever
+      void take()
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _changed.wait(lock, [this] { return _given; });
+        _given = false;
+      }
+
+    private:
+      std::mutex _mutex;
+      std::condition_variable _changed;
+      bool _given = false;
+  };
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary()                       { return new freertos_host::BinarySemaphore(); }
+inline void vSemaphoreDelete(SemaphoreHandle_t s)                        { delete (freertos_host::BinarySemaphore*)s; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s)                    { ((freertos_host::BinarySemaphore*)s)->give();  return pdTRUE; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks)  { ((freertos_host::BinarySemaphore*)s)->take();  return pdTRUE; }
+
+#endif
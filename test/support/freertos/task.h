@@ -0,0 +1,22 @@
+#ifndef task_h
+#define task_h
+
+#include <thread>
+
+#include "FreeRTOS.h"
+
+// the thread ends when the task function returns, so deleting a task is left to that
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, const uint32_t stackBytes, void* parameters,
+                                          UBaseType_t priority, TaskHandle_t* created, const BaseType_t core)
+{
+  std::thread(task, parameters).detach();
+  if (created)
+    *created = nullptr;
+  return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t task)              {}
+inline UBaseType_t uxTaskPriorityGet(TaskHandle_t task) { return 1; }
+inline BaseType_t xPortGetCoreID()                      { return 0; }
+
+#endif
@@ -0,0 +1,264 @@
+#include <unity.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "CrumbExporter.h"
+
+/* CrumbExporter against an independent decoder of the binary stream, with
+ * crumbs appended part way through an export, and its throughput. */
+
+static const uint32_t s_logBytes = 64 * 1024;
+
+static CrumbLog s_log;
+
+// a diver swimming a slow curve with a little position noise, as the GPS gives it
+static CrumbLog::Crumb crumbAt(const int i)
+{
+  const int noise = (int)((i * 2654435761u) >> 29) - 4;
+  return CrumbLog::Crumb::fromDegrees(51.4583 + i * 1.8e-5 + noise * 1e-6, -0.5352 + i * 1.1e-5 - noise * 1e-6,
+                                      (i * 3) % 360, 5.0 + (i % 40) * 0.1, 100000 + i * 5000);
+}
+
+static void appendCrumbs(const int first, const int count)
+{
+  for (int i=first; i < first + count; i++)
+    TEST_ASSERT_TRUE(s_log.append(crumbAt(i)));
+}
+
+static uint32_t varint(const std::vector<uint8_t>& s, size_t& p)
+{
+  uint32_t v = 0;
+  for (int shift = 0; ; shift += 7)
+  {
+    const uint8_t b = s[p++];
+    v |= (uint32_t)(b & 0x7F) << shift;
+    if ((b & 0x80) == 0)
+      return v;
+  }
+}
+
+static int32_t signedVarint(const std::vector<uint8_t>& s, size_t& p)
+{
+  const uint32_t v = varint(s, p);
+  return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+// the stream as a host tool reads it, written from the format in CrumbLog.h and CrumbExporter.h
+static bool decodeBinary(const std::vector<uint8_t>& s, std::vector<CrumbLog::Crumb>& crumbs)
+{
+  if (s.size() < 5 || memcmp(s.data(), "BCL\x01", 4) != 0)
+    return false;
+
+  CrumbLog::Crumb prev;
+  int32_t velLat = 0, velLng = 0, intervalS = 0;
+
+  size_t p = 4;
+  while (p < s.size())
+  {
+    const int count = s[p++];
+    if (count == 0)
+      return p == s.size();
+
+    const size_t bytes = s[p] | (s[p+1] << 8);
+    p += 2;
+    const size_t end = p + bytes;
+
+    for (int i=0; i < count; i++)
+    {
+      const uint8_t flags = s[p++];
+      CrumbLog::Crumb c;
+      if (flags & 0x80)
+      {
+        c.latE6 = signedVarint(s, p);
+        c.lngE6 = signedVarint(s, p);
+        c.timeMs = varint(s, p);
+        c.heading = s[p++];
+        c.depthDm = (int16_t)signedVarint(s, p);
+        velLat = velLng = intervalS = 0;
+      }
+      else
+      {
+        velLat += (flags & 0x01) ? signedVarint(s, p) : 0;
+        velLng += (flags & 0x02) ? signedVarint(s, p) : 0;
+        const int32_t dHeading = (flags & 0x04) ? signedVarint(s, p) : 0;
+        const int32_t dDepth = (flags & 0x08) ? signedVarint(s, p) : 0;
+        intervalS += (flags & 0x10) ? signedVarint(s, p) : 0;
+
+        c.latE6 = prev.latE6 + velLat;
+        c.lngE6 = prev.lngE6 + velLng;
+        c.heading = (uint8_t)(prev.heading + dHeading);
+        c.depthDm = (int16_t)(prev.depthDm + dDepth);
+        c.timeMs = prev.timeMs + intervalS * 1000;
+      }
+      crumbs.push_back(c);
+      prev = c;
+    }
+
+    if (p != end)
+      return false;
+  }
+  return false;
+}
+
+static std::vector<uint8_t> exportAll(CrumbExporter& exporter, const size_t chunkBytes)
+{
+  std::vector<uint8_t> out;
+  std::vector<uint8_t> chunk(chunkBytes);
+  size_t n;
+  while ((n = exporter.read(chunk.data(), chunk.size())) > 0)
+    out.insert(out.end(), chunk.begin(), chunk.begin() + n);
+  return out;
+}
+
+static void assertMatchesLog(const std::vector<CrumbLog::Crumb>& crumbs)
+{
+  TEST_ASSERT_EQUAL_INT(s_log.size(), crumbs.size());
+
+  CrumbLog::Iterator it = s_log.begin();
+  CrumbLog::Crumb expected;
+  for (size_t i=0; i < crumbs.size() && it.next(expected); i++)
+  {
+    TEST_ASSERT_EQUAL_INT(expected.latE6, crumbs[i].latE6);
+    TEST_ASSERT_EQUAL_INT(expected.lngE6, crumbs[i].lngE6);
+    TEST_ASSERT_EQUAL_UINT32(expected.timeMs, crumbs[i].timeMs);
+    TEST_ASSERT_EQUAL_INT(expected.depthDm, crumbs[i].depthDm);
+    TEST_ASSERT_EQUAL_INT(expected.heading, crumbs[i].heading);
+  }
+}
+
+static int countOf(const std::string& text, const char* what)
+{
+  int n = 0;
+  for (size_t p = text.find(what); p != std::string::npos; p = text.find(what, p + 1))
+    n++;
+  return n;
+}
+
+void setUp()
+{
+  s_log.allocate(s_logBytes);
+}
+
+void tearDown()
+{
+  s_log.release();
+}
+
+void test_binary_round_trip_at_any_chunk_size()
+{
+  appendCrumbs(0, 1000);
+
+  const size_t chunkSizes[] = { 1, 7, 64, 1024 };
+  for (const size_t chunkBytes : chunkSizes)
+  {
+    CrumbExporter exporter;
+    exporter.begin(s_log, CrumbExporter::e_binary);
+    std::vector<CrumbLog::Crumb> crumbs;
+    TEST_ASSERT_TRUE(decodeBinary(exportAll(exporter, chunkBytes), crumbs));
+    assertMatchesLog(crumbs);
+    TEST_ASSERT_EQUAL_UINT32(1000, exporter.crumbsExported());
+    TEST_ASSERT_FALSE(exporter.isActive());
+  }
+}
+
+void test_binary_includes_crumbs_appended_to_the_open_segment()
+{
+  // two and a half segments, so the open one is half full when its frame goes out
+  appendCrumbs(0, 2 * CrumbLog::s_segmentCrumbs + 32);
+
+  CrumbExporter exporter;
+  exporter.begin(s_log, CrumbExporter::e_binary);
+
+  std::vector<uint8_t> stream;
+  uint8_t chunk[64];
+  size_t n;
+  int appended = 2 * CrumbLog::s_segmentCrumbs + 32;
+  while ((n = exporter.read(chunk, sizeof(chunk))) > 0)
+  {
+    stream.insert(stream.end(), chunk, chunk + n);
+
+    // a crumb every chunk: fills the open segment after its header is out, then starts another
+    if (exporter.isActive() && appended < 4 * CrumbLog::s_segmentCrumbs + 10)
+      appendCrumbs(appended++, 1);
+  }
+
+  std::vector<CrumbLog::Crumb> crumbs;
+  TEST_ASSERT_TRUE(decodeBinary(stream, crumbs));
+  assertMatchesLog(crumbs);
+  TEST_ASSERT_EQUAL_UINT32(s_log.size(), exporter.crumbsExported());
+}
+
+void test_gpx_includes_crumbs_appended_during_export()
+{
+  appendCrumbs(0, 10);
+
+  CrumbExporter exporter;
+  exporter.begin(s_log, CrumbExporter::e_gpx);
+
+  // faster than they are exported, so the iterator's segment grows under it and the next one opens
+  std::string text;
+  char chunk[100];
+  size_t n;
+  int appended = 10;
+  while ((n = exporter.read((uint8_t*)chunk, sizeof(chunk))) > 0)
+  {
+    text.append(chunk, n);
+    for (int k=0; k < 2 && exporter.isActive() && appended < 3 * CrumbLog::s_segmentCrumbs; k++)
+      appendCrumbs(appended++, 1);
+  }
+
+  TEST_ASSERT_EQUAL_INT(s_log.size(), countOf(text, "<trkpt "));
+  TEST_ASSERT_EQUAL_UINT32(s_log.size(), exporter.crumbsExported());
+  TEST_ASSERT_EQUAL_INT(1, countOf(text, "</gpx>"));
+
+  CrumbLog::Iterator it = s_log.begin();
+  CrumbLog::Crumb expected;
+  for (size_t p = text.find("lat=\""); p != std::string::npos && it.next(expected); p = text.find("lat=\"", p + 1))
+    TEST_ASSERT_DOUBLE_WITHIN(1e-7, expected.lat(), atof(text.c_str() + p + 5));
+}
+
+void test_export_throughput()
+{
+  // as much as the buffer takes, about 14000 crumbs
+  int i = 0;
+  while (s_log.append(crumbAt(i)))
+    i++;
+
+  const CrumbExporter::Format formats[] = { CrumbExporter::e_binary, CrumbExporter::e_gpx };
+  const char* names[] = { "binary", "gpx" };
+  for (int f=0; f < 2; f++)
+  {
+    const int repeats = (formats[f] == CrumbExporter::e_binary ? 200 : 5);
+    size_t bytes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int r=0; r < repeats; r++)
+    {
+      CrumbExporter exporter;
+      exporter.begin(s_log, formats[f]);
+      bytes = exportAll(exporter, 1024).size();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / repeats;
+
+    char message[160];
+    snprintf(message, sizeof(message), "%s: %d crumbs, %lu bytes in %.0fus, %.1f MB/s, %.1f crumbs/us, 1KB chunks",
+             names[f], s_log.size(), (unsigned long)bytes, seconds * 1e6, bytes / seconds / 1e6, s_log.size() / seconds / 1e6);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_GREATER_THAN(0, bytes);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_binary_round_trip_at_any_chunk_size);
+  RUN_TEST(test_binary_includes_crumbs_appended_to_the_open_segment);
+  RUN_TEST(test_gpx_includes_crumbs_appended_during_export);
+  RUN_TEST(test_export_throughput);
+  return UNITY_END();
+}
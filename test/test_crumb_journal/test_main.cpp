@@ -0,0 +1,207 @@
+#include <unity.h>
+
+#include <stdint.h>
+#include <vector>
+
+#include <LittleFS.h>
+
+#include "CrumbJournal.h"
+
+/* CrumbJournal on the in-memory LittleFS: what is appended comes back after a
+ * restart, a torn tail is cut off, and clear() and compact() bound what the
+ * next boot replays. */
+
+static const char* s_journal = "/test.jnl";
+static const char* s_rotated = "/test.prev.jnl";
+
+static CrumbLog::Crumb crumbAt(const int i)
+{
+  return CrumbLog::Crumb::fromDegrees(51.4583 + i * 1e-5, -0.5352 - i * 1e-5, i * 7.0, i * 0.1, 1000 + i * 5000);
+}
+
+static std::vector<CrumbLog::Crumb> recoverAll()
+{
+  CrumbJournal journal;
+  journal.begin(s_journal, s_rotated);
+
+  std::vector<CrumbLog::Crumb> crumbs;
+  journal.recover([&crumbs](const CrumbLog::Crumb& c) { crumbs.push_back(c); });
+  return crumbs;
+}
+
+static void assertCrumbEqual(const CrumbLog::Crumb& expected, const CrumbLog::Crumb& actual)
+{
+  TEST_ASSERT_EQUAL_INT(expected.latE6, actual.latE6);
+  TEST_ASSERT_EQUAL_INT(expected.lngE6, actual.lngE6);
+  TEST_ASSERT_EQUAL_UINT32(expected.timeMs, actual.timeMs);
+  TEST_ASSERT_EQUAL_INT(expected.depthDm, actual.depthDm);
+  TEST_ASSERT_EQUAL_INT(expected.heading, actual.heading);
+}
+
+void setUp()
+{
+  LittleFS.format();
+}
+
+void tearDown()
+{
+}
+
+void test_recover_replays_flushed_records()
+{
+  CrumbJournal journal;
+  journal.begin(s_journal, s_rotated);
+  for (int i=0; i < 40; i++)
+    TEST_ASSERT_TRUE(journal.append(crumbAt(i), i * 1000));
+  TEST_ASSERT_TRUE(journal.flush());
+
+  const std::vector<CrumbLog::Crumb> crumbs = recoverAll();
+  TEST_ASSERT_EQUAL_INT(40, crumbs.size());
+  for (int i=0; i < 40; i++)
+    assertCrumbEqual(crumbAt(i), crumbs[i]);
+}
+
+void test_service_writes_whole_pages()
+{
+  CrumbJournal journal;
+  journal.begin(s_journal, s_rotated);
+  for (int i=0; i < CrumbJournal::s_recordsPerPage + 3; i++)
+    journal.append(crumbAt(i), 0);
+
+  TEST_ASSERT_TRUE(journal.service(0));
+  TEST_ASSERT_EQUAL_INT(3, journal.pendingRecords());
+  TEST_ASSERT_EQUAL_UINT32(CrumbJournal::s_recordsPerPage * CrumbJournal::s_recordBytes, journal.journalBytes());
+
+  // the rest wait until the oldest is s_maxPendingMs old
+  TEST_ASSERT_FALSE(journal.service(CrumbJournal::s_maxPendingMs - 1));
+  TEST_ASSERT_TRUE(journal.service(CrumbJournal::s_maxPendingMs));
+  TEST_ASSERT_EQUAL_INT(0, journal.pendingRecords());
+}
+
+void test_recover_cuts_a_torn_tail()
+{
+  CrumbJournal journal;
+  journal.begin(s_journal, s_rotated);
+  for (int i=0; i < 10; i++)
+    journal.append(crumbAt(i), 0);
+  journal.flush();
+
+  // half a record, as a brown-out part way through a write leaves it
+  fs::File f = LittleFS.open(s_journal, FILE_APPEND);
+  const uint8_t torn[CrumbJournal::s_recordBytes / 2] = { 0xCB };
+  f.write(torn, sizeof(torn));
+  f.close();
+
+  TEST_ASSERT_EQUAL_INT(10, recoverAll().size());
+
+  fs::File g = LittleFS.open(s_journal, FILE_READ);
+  TEST_ASSERT_EQUAL_UINT32(10 * CrumbJournal::s_recordBytes, g.size());
+  g.close();
+}
+
+void test_clear_leaves_nothing_to_replay()
+{
+  CrumbJournal journal;
+  journal.begin(s_journal, s_rotated);
+  for (int i=0; i < 10; i++)
+    journal.append(crumbAt(i), 0);
+  journal.flush();
+  journal.append(crumbAt(10), 0);
+
+  TEST_ASSERT_TRUE(journal.clear());
+  TEST_ASSERT_EQUAL_INT(0, journal.pendingRecords());
+  TEST_ASSERT_TRUE(journal.flush());
+  TEST_ASSERT_EQUAL_INT(0, recoverAll().size());
+
+  // and appends start a fresh journal
+  journal.append(crumbAt(20), 0);
+  journal.flush();
+  const std::vector<CrumbLog::Crumb> crumbs = recoverAll();
+  TEST_ASSERT_EQUAL_INT(1, crumbs.size());
+  assertCrumbEqual(crumbAt(20), crumbs[0]);
+}
+
+void test_compact_keeps_only_the_given_records()
+{
+  CrumbJournal journal;
+  journal.begin(s_journal, s_rotated);
+  for (int i=0; i < 100; i++)
+    journal.append(crumbAt(i), 0);
+  journal.flush();
+  journal.append(crumbAt(100), 0);
+
+  // every tenth, as thinning or a smaller pin store would leave them
+  int next = 0;
+  TEST_ASSERT_TRUE(journal.compact([&next](CrumbLog::Crumb& c)
+  {
+    if (next > 100)
+      return false;
+    c = crumbAt(next);
+    next += 10;
+    return true;
+  }));
+  TEST_ASSERT_EQUAL_INT(0, journal.pendingRecords());
+  TEST_ASSERT_EQUAL_UINT32(11 * CrumbJournal::s_recordBytes, journal.journalBytes());
+  TEST_ASSERT_FALSE(LittleFS.exists("/test.jnl.tmp"));
+
+  const std::vector<CrumbLog::Crumb> crumbs = recoverAll();
+  TEST_ASSERT_EQUAL_INT(11, crumbs.size());
+  for (int i=0; i < 11; i++)
+    assertCrumbEqual(crumbAt(i * 10), crumbs[i]);
+}
+
+void test_full_journal_drops_until_compacted()
+{
+  CrumbJournal journal;
+  journal.begin(s_journal, s_rotated);
+
+  const int capacity = CrumbJournal::s_maxJournalBytes / CrumbJournal::s_recordBytes;
+  int appended = 0;
+  while (!journal.isFull())
+  {
+    TEST_ASSERT_TRUE(journal.append(crumbAt(appended), 0));
+    journal.service(0);
+    appended++;
+  }
+  TEST_ASSERT_EQUAL_INT(capacity, appended);
+  TEST_ASSERT_FALSE(journal.append(crumbAt(appended), 0));
+  TEST_ASSERT_EQUAL_UINT32(1, journal.recordsDropped());
+
+  // a source bigger than the journal is cut at s_maxJournalBytes rather than failing
+  int next = 0;
+  TEST_ASSERT_TRUE(journal.compact([&next](CrumbLog::Crumb& c) { c = crumbAt(next++); return true; }));
+  TEST_ASSERT_LESS_OR_EQUAL(CrumbJournal::s_maxJournalBytes, journal.journalBytes());
+
+  next = 0;
+  TEST_ASSERT_TRUE(journal.compact([&next](CrumbLog::Crumb& c) { c = crumbAt(next); return ++next <= 50; }));
+  TEST_ASSERT_FALSE(journal.isFull());
+  TEST_ASSERT_TRUE(journal.append(crumbAt(50), 0));
+  journal.flush();
+  TEST_ASSERT_EQUAL_INT(51, recoverAll().size());
+}
+
+void test_rotate_moves_the_journal_aside()
+{
+  CrumbJournal journal;
+  journal.begin(s_journal, s_rotated);
+  for (int i=0; i < 5; i++)
+    journal.append(crumbAt(i), 0);
+
+  TEST_ASSERT_TRUE(journal.rotate());
+  TEST_ASSERT_FALSE(LittleFS.exists(s_journal));
+  TEST_ASSERT_TRUE(LittleFS.exists(s_rotated));
+  TEST_ASSERT_EQUAL_INT(0, recoverAll().size());
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_recover_replays_flushed_records);
+  RUN_TEST(test_service_writes_whole_pages);
+  RUN_TEST(test_recover_cuts_a_torn_tail);
+  RUN_TEST(test_clear_leaves_nothing_to_replay);
+  RUN_TEST(test_compact_keeps_only_the_given_records);
+  RUN_TEST(test_full_journal_drops_until_compacted);
+  RUN_TEST(test_rotate_moves_the_journal_aside);
+  return UNITY_END();
+}
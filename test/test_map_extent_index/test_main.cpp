@@ -0,0 +1,185 @@
+#include <unity.h>
+
+#include <stdint.h>
+#include <math.h>
+
+#include "MapExtentIndex.h"
+#include "SiteFrame.h"
+#include "TestRandom.h"
+
+/* MapExtentIndex's boxes against the projection they stand in for: a million
+ * random points around each map must be in the box exactly when
+ * convertGeoToFractionalPixel puts them on the map's image. Then the index's
+ * lookups, and the distance past an edge at which map switch hysteresis lets
+ * a switch go. */
+
+static const int s_points = 1000000;
+
+// a detail map's corners, and the screen sizes its image may be drawn at
+static const float s_lngLeft = -0.5512f;
+static const float s_lngRight = -0.5470f;
+static const float s_latBottom = 51.4590f;
+
+static TestRandom s_random;
+
+// MapScreen_ex::convertGeoToFractionalPixel
+static void convertGeoToFractionalPixel(const double latitude, const double longitude, const float lngLeft, const float lngRight,
+                                        const float latBottom, const int16_t mapWidth, const int16_t mapHeight, double& x, double& y)
+{
+  const double mapLatBottomRad = latBottom * M_PI / 180.0;
+  const double latitudeRad = latitude * M_PI / 180.0;
+  const double mapLngDelta = ((double)lngRight - lngLeft);
+
+  const double worldMapWidth = ((mapWidth / mapLngDelta) * 360.0) / (2.0 * M_PI);
+  const double mapOffsetY = (worldMapWidth / 2.0 * log((1.0 + sin(mapLatBottomRad)) / (1.0 - sin(mapLatBottomRad))));
+
+  x = (longitude - lngLeft) * ((double)mapWidth / mapLngDelta);
+  y = (double)mapHeight - ((worldMapWidth / 2.0 * log((1.0 + sin(latitudeRad)) / (1.0 - sin(latitudeRad)))) - mapOffsetY);
+}
+
+static void checkAgreesWithProjection(const int16_t width, const int16_t height)
+{
+  MapExtentIndex index;
+  index.add(0, true, s_lngLeft, s_lngRight, s_latBottom, width, height);
+  const MapExtentIndex::Extent* e = index.extent(0);
+  TEST_ASSERT_NOT_NULL(e);
+
+  // a quarter of the map's size again all round, so the edges are crossed as often as not
+  const double latSpan = e->north - e->south;
+  const double lngSpan = e->east - e->west;
+
+  int mismatches = 0;
+  int inside = 0;
+  for (int i = 0; i < s_points; i++)
+  {
+    const double lat = e->south - latSpan / 4 + s_random.unit() * latSpan * 1.5;
+    const double lng = e->west - lngSpan / 4 + s_random.unit() * lngSpan * 1.5;
+
+    double x, y;
+    convertGeoToFractionalPixel(lat, lng, s_lngLeft, s_lngRight, s_latBottom, width, height, x, y);
+    const bool onImage = (x >= 0 && x < width && y >= 0 && y < height);
+    if (onImage != index.contains(0, lat, lng))
+      mismatches++;
+    if (onImage)
+      inside++;
+  }
+
+  TEST_ASSERT_EQUAL_INT(0, mismatches);
+  TEST_ASSERT_INT_WITHIN(s_points / 20, s_points * 4 / 9, inside);
+}
+
+void setUp()
+{
+  s_random.seed(12345);
+}
+
+void tearDown()
+{
+}
+
+void test_agrees_with_projection_t4()
+{
+  checkAgreesWithProjection(320, 240);
+}
+
+void test_agrees_with_projection_m5()
+{
+  checkAgreesWithProjection(135, 240);
+}
+
+void test_first_containing_is_lowest_detail_map()
+{
+  MapExtentIndex index;
+  TEST_ASSERT_TRUE(index.isEmpty());
+
+  // 2 and 1 overlap, the whole lake map 3 covers both but is never picked
+  index.add(2, true, -0.5512f, -0.5470f, 51.4590f, 320, 240);
+  index.add(1, true, -0.5490f, -0.5450f, 51.4600f, 320, 240);
+  index.add(3, false, -0.5600f, -0.5400f, 51.4500f, 320, 240);
+  TEST_ASSERT_FALSE(index.isEmpty());
+
+  TEST_ASSERT_EQUAL_INT(2, index.firstContaining(51.4600, -0.5500));
+  TEST_ASSERT_EQUAL_INT(1, index.firstContaining(51.4605, -0.5480));
+  TEST_ASSERT_EQUAL_INT(1, index.firstContaining(51.4605, -0.5460));
+  TEST_ASSERT_EQUAL_INT(-1, index.firstContaining(51.4520, -0.5500));
+  TEST_ASSERT_TRUE(index.contains(3, 51.4520, -0.5500));
+
+  TEST_ASSERT_NULL(index.extent(4));
+  TEST_ASSERT_FALSE(index.contains(4, 51.4600, -0.5500));
+
+  index.clear();
+  TEST_ASSERT_TRUE(index.isEmpty());
+  TEST_ASSERT_EQUAL_INT(-1, index.firstContaining(51.4600, -0.5500));
+}
+
+void test_metres_outside()
+{
+  MapExtentIndex index;
+  index.add(0, true, s_lngLeft, s_lngRight, s_latBottom, 320, 240);
+  const MapExtentIndex::Extent& e = *index.extent(0);
+
+  SiteFrame frame;
+  frame.setOrigin((e.south + e.north) / 2, (e.west + e.east) / 2);
+  const double mLat = frame.metresPerDegreeLat();
+  const double mLong = frame.metresPerDegreeLong();
+
+  TEST_ASSERT_EQUAL_FLOAT(0, e.metresOutside(frame.originLat(), frame.originLong(), mLat, mLong));
+
+  // straight out of each side, then out past a corner
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 5.0f, e.metresOutside(e.north + 5 / mLat, frame.originLong(), mLat, mLong));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 7.0f, e.metresOutside(e.south - 7 / mLat, frame.originLong(), mLat, mLong));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 3.0f, e.metresOutside(frame.originLat(), e.east + 3 / mLong, mLat, mLong));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 9.0f, e.metresOutside(frame.originLat(), e.west - 9 / mLong, mLat, mLong));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 5.0f, e.metresOutside(e.north + 4 / mLat, e.east + 3 / mLong, mLat, mLong));
+
+  // against the site frame's own distance to the nearest corner
+  const double lat = e.south - 20 / mLat;
+  const double lng = e.west - 15 / mLong;
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, SiteFrame::distance(frame.toLocal(e.south, e.west), frame.toLocal(lat, lng)),
+                           e.metresOutside(lat, lng, mLat, mLong));
+}
+
+void test_holds_switch_only_from_a_detail_map()
+{
+  // detail map 1 inside all lake map 0, the diver 4m south of map 1
+  MapExtentIndex index;
+  index.add(1, true, s_lngLeft, s_lngRight, s_latBottom, 320, 240);
+  index.add(0, false, -0.5600f, -0.5400f, 51.4500f, 320, 240);
+  const MapExtentIndex::Extent& e = *index.extent(1);
+
+  SiteFrame frame;
+  float beyond = -1;
+  TEST_ASSERT_FALSE(index.holdsSwitchFrom(1, e.south, e.west, frame, 10, beyond));
+  TEST_ASSERT_EQUAL_FLOAT(0, beyond);
+
+  frame.setOrigin(e.south, e.west);
+  const double lat = e.south - 4 / frame.metresPerDegreeLat();
+  const double lng = (e.west + e.east) / 2;
+
+  TEST_ASSERT_TRUE(index.holdsSwitchFrom(1, lat, lng, frame, 10, beyond));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 4.0f, beyond);
+  TEST_ASSERT_FALSE(index.holdsSwitchFrom(1, lat, lng, frame, 3, beyond));
+  TEST_ASSERT_FALSE(index.holdsSwitchFrom(1, lat, lng, frame, 0, beyond));
+
+  // on the detail map itself a switch the subclass asks for waits until the diver is off it by the margin
+  TEST_ASSERT_TRUE(index.holdsSwitchFrom(1, e.south + 4 / frame.metresPerDegreeLat(), lng, frame, 10, beyond));
+  TEST_ASSERT_EQUAL_FLOAT(0, beyond);
+
+  // all lake -> detail map: the all lake map always has the diver on it, so holding would hold forever
+  TEST_ASSERT_TRUE(index.contains(0, lat, lng));
+  TEST_ASSERT_FALSE(index.holdsSwitchFrom(0, lat, lng, frame, 10, beyond));
+  TEST_ASSERT_FALSE(index.holdsSwitchFrom(0, e.south + 4 / frame.metresPerDegreeLat(), lng, frame, 10, beyond));
+
+  TEST_ASSERT_FALSE(index.holdsSwitchFrom(2, lat, lng, frame, 10, beyond));
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_agrees_with_projection_t4);
+  RUN_TEST(test_agrees_with_projection_m5);
+  RUN_TEST(test_first_containing_is_lowest_detail_map);
+  RUN_TEST(test_metres_outside);
+  RUN_TEST(test_holds_switch_only_from_a_detail_map);
+  return UNITY_END();
+}
@@ -0,0 +1,117 @@
+#include <unity.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "SiteFrame.h"
+#include "TestRandom.h"
+#include "TinyGPS++.h"
+
+/* SiteFrame against the exact ellipsoidal maths it stands in for, over a 2km
+ * site: pairs of points anywhere within 1km of the origin. */
+
+static const double s_originLat = 51.4583;
+static const double s_originLong = -0.5352;
+static const double s_siteRadiusMetres = 1000.0;
+
+static SiteFrame s_frame;
+
+static TestRandom s_random;
+
+static void randomSitePoint(double& lat, double& lng)
+{
+  lat = s_originLat + s_random.signedUnit() * s_siteRadiusMetres / s_frame.metresPerDegreeLat();
+  lng = s_originLong + s_random.signedUnit() * s_siteRadiusMetres / s_frame.metresPerDegreeLong();
+}
+
+void setUp()
+{
+  s_frame.setOrigin(s_originLat, s_originLong);
+  s_random.seed(12345);
+}
+
+void tearDown()
+{
+}
+
+void test_origin_is_zero()
+{
+  const SiteFrame::point p = s_frame.toLocal(s_originLat, s_originLong);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6, 0.0, p.e);
+  TEST_ASSERT_FLOAT_WITHIN(1e-6, 0.0, p.n);
+}
+
+void test_round_trip()
+{
+  for (int i=0; i < 1000; i++)
+  {
+    double lat, lng, backLat, backLng;
+    randomSitePoint(lat, lng);
+    s_frame.toGeo(s_frame.toLocal(lat, lng), backLat, backLng);
+
+    // float metres: a millimetre or so
+    TEST_ASSERT_DOUBLE_WITHIN(1e-7, lat, backLat);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-7, lng, backLng);
+  }
+}
+
+void test_distance_within_bound_of_accurate()
+{
+  double worst = 0;
+  for (int i=0; i < 20000; i++)
+  {
+    double lat1, lng1, lat2, lng2;
+    randomSitePoint(lat1, lng1);
+    randomSitePoint(lat2, lng2);
+
+    const double exact = TinyGPSPlus::distanceBetweenAccurate(lat1, lng1, lat2, lng2);
+    const double local = SiteFrame::distance(s_frame.toLocal(lat1, lng1), s_frame.toLocal(lat2, lng2));
+    const double error = fabs(local - exact);
+
+    // as SiteFrame.h promises: within 0.05% of the ellipsoidal distance, under 0.4m across the site
+    TEST_ASSERT_LESS_OR_EQUAL(0.4, error);
+    TEST_ASSERT_LESS_OR_EQUAL(exact * 0.0005 + 0.01, error);
+    worst = fmax(worst, error);
+  }
+
+  char message[64];
+  snprintf(message, sizeof(message), "worst distance error %.3fm", worst);
+  TEST_MESSAGE(message);
+}
+
+void test_course_within_bound_of_course_to()
+{
+  double worst = 0;
+  for (int i=0; i < 20000; i++)
+  {
+    double lat1, lng1, lat2, lng2;
+    randomSitePoint(lat1, lng1);
+    randomSitePoint(lat2, lng2);
+
+    // a course over a few metres is dominated by float rounding, and no use for navigation anyway
+    if (TinyGPSPlus::distanceBetweenAccurate(lat1, lng1, lat2, lng2) < 10.0)
+      continue;
+
+    const double exact = TinyGPSPlus::courseTo(lat1, lng1, lat2, lng2);
+    const double local = SiteFrame::degreesCourse(s_frame.toLocal(lat1, lng1), s_frame.toLocal(lat2, lng2));
+    const double error = fabs(fmod(local - exact + 540.0, 360.0) - 180.0);
+
+    TEST_ASSERT_LESS_OR_EQUAL(0.1, error);
+    worst = fmax(worst, error);
+  }
+
+  char message[64];
+  snprintf(message, sizeof(message), "worst course error %.4f degrees", worst);
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_origin_is_zero);
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_distance_within_bound_of_accurate);
+  RUN_TEST(test_course_within_bound_of_course_to);
+  return UNITY_END();
+}
@@ -0,0 +1,142 @@
+#include <unity.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include <PNGdec.h>
+
+#include "SlicedTask.h"
+#include "test_png.h"
+
+/* A PNG decoded a few rows a slice, on its own task as MapScreen_ex's map
+ * switch does, comes out the same as decoding it in one go. */
+
+static PNG s_png;
+static std::vector<uint16_t> s_pixels;
+static SlicedTask s_slicedTask;
+static int s_rowsDecoded;
+static int s_decodeResult;
+
+static int drawRow(PNGDRAW* pDraw)
+{
+  s_png.getLineAsRGB565(pDraw, &s_pixels[(size_t)pDraw->y * pDraw->iWidth], PNG_RGB565_BIG_ENDIAN, 0xffffffff);
+  s_rowsDecoded = pDraw->y + 1;
+
+  if (s_slicedTask.isRunning())
+    s_slicedTask.step();
+  return 1;
+}
+
+static void decodeJob(void* context)
+{
+  s_decodeResult = s_png.decode(NULL, 0);
+  s_png.close();
+}
+
+static bool openTestPng()
+{
+  s_pixels.assign((size_t)s_testPngWidth * s_testPngHeight, 0xF81F);
+  s_rowsDecoded = 0;
+  s_decodeResult = -1;
+  return s_png.openRAM(s_testPng, sizeof(s_testPng), drawRow) == PNG_SUCCESS;
+}
+
+static std::vector<uint16_t> decodeSingleShot()
+{
+  TEST_ASSERT_TRUE(openTestPng());
+  TEST_ASSERT_EQUAL_INT(PNG_SUCCESS, s_png.decode(NULL, 0));
+  s_png.close();
+  return s_pixels;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+  s_slicedTask.finish();
+}
+
+void test_single_shot_decodes_every_row()
+{
+  const std::vector<uint16_t> pixels = decodeSingleShot();
+  TEST_ASSERT_EQUAL_INT(s_testPngHeight, s_rowsDecoded);
+
+  // the test image has no flat rows, so a row left at the fill colour wasn't written
+  for (int y=0; y < s_testPngHeight; y++)
+  {
+    int filled = 0;
+    for (int x=0; x < s_testPngWidth; x++)
+      filled += (pixels[(size_t)y * s_testPngWidth + x] == 0xF81F);
+    TEST_ASSERT_LESS_OR_EQUAL(s_testPngWidth / 2, filled);
+  }
+}
+
+void test_sliced_by_rows_matches_single_shot()
+{
+  const std::vector<uint16_t> expected = decodeSingleShot();
+
+  const int sliceRows = 5;
+  TEST_ASSERT_TRUE(openTestPng());
+  TEST_ASSERT_TRUE(s_slicedTask.start(decodeJob, nullptr, "pngSlice", 16384));
+
+  int slices = 0;
+  bool finished = false;
+  while (!finished)
+  {
+    const int before = s_rowsDecoded;
+    finished = s_slicedTask.resume(0, sliceRows);
+    slices++;
+
+    // a slice hands back after its rows, and the rest of the buffer is untouched meanwhile
+    if (!finished)
+      TEST_ASSERT_EQUAL_INT(before + sliceRows, s_rowsDecoded);
+    TEST_ASSERT_LESS_OR_EQUAL(s_testPngHeight, slices);
+  }
+
+  TEST_ASSERT_EQUAL_INT(PNG_SUCCESS, s_decodeResult);
+  TEST_ASSERT_EQUAL_INT(s_testPngHeight, s_rowsDecoded);
+  TEST_ASSERT_EQUAL_INT((s_testPngHeight + sliceRows - 1) / sliceRows, slices);
+  TEST_ASSERT_EQUAL_MEMORY(expected.data(), s_pixels.data(), expected.size() * sizeof(uint16_t));
+}
+
+void test_sliced_by_time_matches_single_shot()
+{
+  const std::vector<uint16_t> expected = decodeSingleShot();
+
+  TEST_ASSERT_TRUE(openTestPng());
+  TEST_ASSERT_TRUE(s_slicedTask.start(decodeJob, nullptr, "pngSlice", 16384));
+  while (!s_slicedTask.resume(50, 0))
+    ;
+
+  TEST_ASSERT_EQUAL_INT(PNG_SUCCESS, s_decodeResult);
+  TEST_ASSERT_EQUAL_MEMORY(expected.data(), s_pixels.data(), expected.size() * sizeof(uint16_t));
+}
+
+void test_finish_part_way_matches_single_shot()
+{
+  const std::vector<uint16_t> expected = decodeSingleShot();
+
+  // as drawPNG does when the sliced map is wanted before it's whole
+  TEST_ASSERT_TRUE(openTestPng());
+  TEST_ASSERT_TRUE(s_slicedTask.start(decodeJob, nullptr, "pngSlice", 16384));
+  TEST_ASSERT_FALSE(s_slicedTask.resume(0, 3));
+  s_slicedTask.finish();
+
+  TEST_ASSERT_FALSE(s_slicedTask.isRunning());
+  TEST_ASSERT_EQUAL_INT(PNG_SUCCESS, s_decodeResult);
+  TEST_ASSERT_EQUAL_MEMORY(expected.data(), s_pixels.data(), expected.size() * sizeof(uint16_t));
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_single_shot_decodes_every_row);
+  RUN_TEST(test_sliced_by_rows_matches_single_shot);
+  RUN_TEST(test_sliced_by_time_matches_single_shot);
+  RUN_TEST(test_finish_part_way_matches_single_shot);
+  return UNITY_END();
+}
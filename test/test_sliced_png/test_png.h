@@ -0,0 +1,385 @@
+#ifndef test_png_h
+#define test_png_h
+
+#include <stdint.h>
+
+// 64x32 RGB, 8 bits a channel, rows using each of the five PNG filters in turn: a gradient with noise, so every row differs
+static const int s_testPngWidth = 64;
+static const int s_testPngHeight = 32;
+static uint8_t s_testPng[] =
+{
+  0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xE9,
+  0xD3, 0x00, 0x00, 0x17, 0x06, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x25, 0xC8, 0x0B, 0x5C, 0xCD,
+  0x0C, 0xFC, 0xC7, 0xF1, 0x51, 0xB4, 0xD4, 0xC3, 0xC8, 0x65, 0xB9, 0x1E, 0xB7, 0x98, 0xFB, 0x24,
+  0x1C, 0x42, 0x43, 0xC5, 0x14, 0x99, 0xFB, 0x71, 0xED, 0x88, 0x98, 0x44, 0xE6, 0xC9, 0x65, 0x2E,
+  0x31, 0x1E, 0x69, 0x8F, 0x88, 0xB9, 0xC4, 0x24, 0x4C, 0xC2, 0x50, 0x3A, 0xEE, 0xE6, 0x3E, 0x24,
+  0x23, 0x97, 0x3D, 0x11, 0xE6, 0x3E, 0x25, 0x4D, 0xC4, 0xDC, 0xED, 0x7F, 0xFE, 0xFF, 0xFF, 0xEB,
+  0xF5, 0x7D, 0x7D, 0x5E, 0xEF, 0xDF, 0x0F, 0xF0, 0x05, 0x7C, 0x6B, 0x00, 0x75, 0x1A, 0x03, 0x8D,
+  0x9B, 0x02, 0x4D, 0x3D, 0x80, 0x96, 0xB5, 0x01, 0xFF, 0x86, 0x40, 0xC3, 0x3A, 0x40, 0x3B, 0x14,
+  0x40, 0x5B, 0x03, 0xAD, 0x5B, 0x03, 0x41, 0xFD, 0x80, 0x7E, 0x9D, 0x80, 0xA1, 0x01, 0x40, 0x58,
+  0x10, 0x10, 0xDA, 0x17, 0xE8, 0x3B, 0x18, 0x18, 0xDC, 0x1F, 0xC0, 0xC3, 0x80, 0xD1, 0x83, 0x80,
+  0xA8, 0x08, 0x20, 0x6E, 0x34, 0x30, 0x66, 0x28, 0x30, 0x27, 0x1C, 0x48, 0x8C, 0x03, 0x66, 0x4F,
+  0x03, 0x62, 0x96, 0x01, 0xCB, 0xDD, 0xA0, 0x81, 0xC5, 0x14, 0xB0, 0x38, 0x0E, 0x58, 0x47, 0x01,
+  0x29, 0x0C, 0xB0, 0x72, 0x3D, 0x90, 0xBA, 0x13, 0xE0, 0x53, 0x81, 0xF5, 0x2B, 0x81, 0xBD, 0x6E,
+  0xA4, 0x01, 0x99, 0x6B, 0x81, 0x9C, 0x13, 0xC0, 0xC9, 0xB3, 0xC0, 0xE5, 0x13, 0xC0, 0xD5, 0x3C,
+  0x20, 0xFF, 0x1C, 0x70, 0xFE, 0x14, 0x70, 0x59, 0x00, 0xFE, 0x3B, 0x0F, 0x9C, 0xBB, 0x01, 0xDC,
+  0x2C, 0x02, 0xD4, 0xC7, 0xC0, 0xA3, 0xBB, 0x40, 0xD9, 0x1D, 0xA0, 0x5C, 0x01, 0x3E, 0x14, 0x00,
+  0xA5, 0x17, 0x81, 0x1F, 0xCF, 0x81, 0x97, 0x5F, 0x80, 0xAF, 0x06, 0xF0, 0xFE, 0x1B, 0x50, 0xD5,
+  0x02, 0x7E, 0xFF, 0x7F, 0xDF, 0x02, 0x75, 0xAB, 0xD4, 0x05, 0xE1, 0x7A, 0xA0, 0x3F, 0x0C, 0x36,
+  0xF6, 0x04, 0xE1, 0x1A, 0x60, 0xA7, 0x06, 0x60, 0xA3, 0xBA, 0x60, 0x5B, 0x6F, 0x30, 0xC8, 0x06,
+  0xB6, 0xEA, 0x02, 0x06, 0x77, 0x03, 0x07, 0x05, 0x81, 0x83, 0x7B, 0x81, 0x7D, 0x5B, 0x81, 0x83,
+  0x82, 0xC1, 0x10, 0x04, 0x1C, 0x35, 0x02, 0x1C, 0x13, 0x0A, 0x0E, 0x1E, 0x01, 0xC6, 0x86, 0x83,
+  0xE3, 0x43, 0xC0, 0x98, 0x89, 0xE0, 0x94, 0x08, 0x30, 0x21, 0x14, 0x5C, 0x38, 0x0D, 0x9C, 0xB1,
+  0x04, 0x5C, 0x11, 0x0B, 0x2E, 0x5E, 0x0C, 0xAE, 0x59, 0x08, 0x2E, 0x8D, 0x03, 0xD3, 0xDC, 0x23,
+  0xC1, 0xAD, 0xDB, 0xC0, 0x9D, 0x3C, 0xB8, 0x7B, 0x2B, 0x78, 0x70, 0x33, 0x98, 0x9D, 0x06, 0x72,
+  0xAB, 0xC1, 0xEC, 0x5D, 0xE0, 0x9E, 0xED, 0xE0, 0xFE, 0xBD, 0x60, 0xD6, 0x39, 0xF0, 0xD2, 0x51,
+  0x30, 0x37, 0x17, 0xBC, 0x73, 0x1E, 0xBC, 0x28, 0x80, 0x37, 0x8F, 0x82, 0x77, 0xF7, 0x80, 0x4F,
+  0x1E, 0x81, 0xCF, 0xF2, 0xC1, 0xA2, 0xDB, 0x60, 0xE1, 0x7D, 0xB0, 0xFC, 0x09, 0xF8, 0xF2, 0x01,
+  0x58, 0x7C, 0x09, 0xFC, 0xFA, 0x0C, 0x7C, 0x61, 0x80, 0x15, 0xEF, 0xC0, 0xCF, 0x3A, 0xF8, 0xED,
+  0x23, 0x58, 0xEB, 0x2D, 0xE8, 0x5D, 0x0A, 0x36, 0x78, 0x0D, 0x36, 0xFC, 0x0D, 0x56, 0xAD, 0xEA,
+  0x03, 0xF9, 0x35, 0x83, 0xDA, 0x40, 0x50, 0x5B, 0x2F, 0xA8, 0x99, 0x2F, 0xD4, 0xAD, 0x36, 0xD4,
+  0xBC, 0x01, 0xD4, 0xD9, 0x1F, 0x42, 0xBA, 0x43, 0x7D, 0x5B, 0x42, 0x81, 0x6D, 0xA0, 0x7E, 0xED,
+  0xA0, 0x5E, 0x76, 0x08, 0xEB, 0x0B, 0x85, 0x05, 0x42, 0x43, 0xBA, 0x43, 0x43, 0xC7, 0x43, 0x53,
+  0xA3, 0xA0, 0x29, 0x91, 0xD0, 0xA8, 0x01, 0xD0, 0xD4, 0xC9, 0x50, 0xEC, 0x48, 0x68, 0x62, 0x28,
+  0xB4, 0x24, 0x02, 0xFA, 0x9B, 0x82, 0x16, 0xC7, 0x42, 0xF1, 0x09, 0x50, 0x72, 0x3C, 0xB4, 0x60,
+  0x31, 0xC4, 0xCC, 0x86, 0xB8, 0x78, 0x68, 0xEB, 0x1C, 0x68, 0x4B, 0x06, 0xB4, 0x3F, 0x05, 0xDA,
+  0xC1, 0x43, 0xFB, 0xB6, 0x42, 0x47, 0xB6, 0x40, 0xBB, 0x52, 0xA1, 0x93, 0x6B, 0xA0, 0xF3, 0xE9,
+  0x50, 0xF6, 0x71, 0xE8, 0x5C, 0x2E, 0x74, 0xF1, 0x34, 0x74, 0x25, 0x1B, 0x3A, 0x73, 0x04, 0x7A,
+  0xB0, 0x1F, 0x52, 0xF6, 0x43, 0x4F, 0xDD, 0xCB, 0x87, 0xEE, 0x5F, 0x84, 0xEE, 0x69, 0xD0, 0xEB,
+  0x22, 0xA8, 0xFC, 0x21, 0xF4, 0xB2, 0x00, 0xFA, 0xAE, 0x42, 0x1F, 0x2E, 0x41, 0x1E, 0xEF, 0x21,
+  0xF3, 0x13, 0x04, 0x3C, 0x87, 0x7E, 0x54, 0x42, 0xB5, 0x3F, 0x41, 0xDF, 0xDE, 0x41, 0xF0, 0x4B,
+  0x08, 0x7E, 0x01, 0xB5, 0xF0, 0x80, 0xE0, 0xC6, 0x35, 0xE0, 0xA6, 0xD5, 0xE0, 0xE6, 0x10, 0xDC,
+  0xCD, 0x1B, 0x0E, 0x6A, 0x06, 0xB7, 0xAF, 0x03, 0x77, 0xAA, 0x0A, 0x87, 0x05, 0xC2, 0xFD, 0xFA,
+  0xC2, 0xB8, 0x0D, 0x0E, 0xEE, 0x06, 0x47, 0xB5, 0x87, 0xC7, 0x74, 0x83, 0x43, 0x7A, 0xC3, 0xE1,
+  0x7D, 0xE0, 0xC1, 0xFD, 0xE1, 0xA1, 0x0E, 0x38, 0x7E, 0x00, 0x3C, 0x79, 0x12, 0x4C, 0x0E, 0x82,
+  0xE7, 0x8F, 0x85, 0x67, 0x8F, 0x82, 0xE7, 0x4E, 0x82, 0x67, 0x25, 0xC2, 0xCC, 0x32, 0x98, 0x4D,
+  0x80, 0xFF, 0x9D, 0x01, 0x2F, 0x75, 0xC3, 0x7D, 0x4E, 0x81, 0x77, 0x3A, 0xE1, 0xFD, 0x9B, 0xE1,
+  0x4C, 0x16, 0xCE, 0xD8, 0x00, 0x1F, 0x5E, 0x03, 0xEF, 0xD9, 0x01, 0x67, 0x65, 0xC0, 0x87, 0x38,
+  0x38, 0x77, 0x0B, 0x9C, 0x77, 0x18, 0x3E, 0x75, 0x10, 0xBE, 0x20, 0xC2, 0x67, 0x24, 0xB8, 0xE0,
+  0x30, 0xFC, 0xF8, 0x2C, 0xAC, 0x1C, 0x85, 0x1F, 0xED, 0x87, 0x5F, 0x3C, 0x86, 0xDF, 0xDC, 0x83,
+  0x5F, 0x17, 0xC0, 0xEA, 0x13, 0xF8, 0xDD, 0x15, 0xB8, 0xFC, 0x29, 0x5C, 0x76, 0x17, 0xFE, 0x70,
+  0x03, 0xFE, 0xF3, 0x16, 0xFE, 0x58, 0x06, 0xFF, 0x36, 0x61, 0xE8, 0x17, 0x5C, 0xC3, 0xBD, 0x4A,
+  0xB8, 0x5A, 0x29, 0xDC, 0xA0, 0x12, 0xAE, 0xEB, 0xE9, 0x69, 0xAB, 0xEB, 0x6B, 0x6B, 0x0C, 0xDB,
+  0xDA, 0x36, 0xB0, 0xF5, 0xA8, 0x62, 0x43, 0x01, 0x5B, 0x4F, 0x2F, 0x5B, 0x78, 0x53, 0x5B, 0xA7,
+  0xEE, 0xB6, 0xB0, 0xB6, 0xB6, 0x90, 0x8E, 0xB6, 0x3E, 0xC1, 0xB6, 0x88, 0xCE, 0xB6, 0xC9, 0xAD,
+  0x6D, 0xA3, 0xBA, 0xD9, 0x46, 0xB6, 0xB6, 0x4D, 0x1B, 0x64, 0x1B, 0x3B, 0xD0, 0x36, 0x32, 0xDC,
+  0x16, 0x3B, 0xC9, 0x16, 0x3F, 0xC1, 0x16, 0x37, 0xDE, 0x36, 0x6F, 0xA2, 0x2D, 0x8E, 0xB0, 0xD1,
+  0x94, 0x6D, 0xE5, 0x74, 0xDB, 0x82, 0x69, 0xB6, 0x55, 0x09, 0xB6, 0x6D, 0xB1, 0xB6, 0x2D, 0x71,
+  0xB6, 0x9D, 0xD3, 0x6C, 0xC2, 0x54, 0xDB, 0xC1, 0x74, 0x5B, 0x76, 0x9A, 0x2D, 0x3B, 0xC9, 0xB6,
+  0x3B, 0xC5, 0xB6, 0x77, 0x8B, 0x6D, 0x3F, 0x6B, 0xBB, 0xBC, 0xDE, 0x76, 0xFE, 0x1F, 0xDB, 0xF5,
+  0x83, 0xB6, 0xB3, 0xA2, 0x4D, 0x3A, 0x69, 0x53, 0xB3, 0x6D, 0x97, 0xF7, 0xDB, 0xD4, 0x63, 0xB6,
+  0x1B, 0xFB, 0x6C, 0x6F, 0x05, 0x9B, 0x2E, 0xDB, 0x8A, 0x9E, 0xD8, 0x8C, 0x4B, 0xB6, 0x57, 0xD7,
+  0x6D, 0x6F, 0x0A, 0x6D, 0x2F, 0x1F, 0xDB, 0x3E, 0xAA, 0xB6, 0xAF, 0x8F, 0x6C, 0x95, 0xA6, 0xCD,
+  0xB3, 0xD2, 0xE6, 0x5D, 0x62, 0xFB, 0xF1, 0xC9, 0x06, 0x97, 0xDB, 0x9A, 0x7D, 0xB0, 0x35, 0xF9,
+  0x6C, 0xAB, 0x5F, 0x69, 0x83, 0x01, 0x2F, 0xA4, 0xD1, 0x5F, 0x48, 0xF3, 0xFA, 0x48, 0x2F, 0x1F,
+  0xA4, 0x8D, 0x1F, 0xD2, 0xA6, 0x1E, 0x82, 0xD4, 0x45, 0x7A, 0xFA, 0x21, 0xFD, 0x9A, 0x23, 0x41,
+  0xBD, 0x90, 0xD1, 0x9D, 0x91, 0x01, 0x2D, 0x90, 0xA1, 0x6D, 0x90, 0xF1, 0xED, 0x90, 0xE9, 0x7D,
+  0x90, 0xE1, 0x9D, 0x91, 0xA9, 0x91, 0x48, 0xF4, 0x24, 0x64, 0x5E, 0x38, 0x32, 0x6B, 0x02, 0x32,
+  0x77, 0x3C, 0x32, 0x67, 0x0C, 0x42, 0x4E, 0x40, 0x12, 0x06, 0x21, 0xAB, 0xA7, 0x21, 0x0B, 0x17,
+  0x21, 0xDC, 0x12, 0x24, 0x2D, 0x16, 0x49, 0x49, 0x40, 0x56, 0xC5, 0x23, 0x7B, 0x17, 0x21, 0xFF,
+  0x52, 0x48, 0x06, 0x8B, 0x64, 0xAC, 0x42, 0xD2, 0x53, 0x91, 0xBD, 0x19, 0x48, 0xDE, 0x7A, 0xE4,
+  0x72, 0x12, 0x22, 0xA5, 0x22, 0x57, 0x58, 0xE4, 0x5A, 0x0E, 0x22, 0xEF, 0x46, 0xCE, 0xE5, 0x21,
+  0x6A, 0x2E, 0xF2, 0xEC, 0x28, 0xF2, 0x62, 0x37, 0xF2, 0x6C, 0x2F, 0xF2, 0x66, 0x2F, 0x52, 0x7E,
+  0x17, 0x79, 0x7B, 0x17, 0xF9, 0xF0, 0x18, 0x29, 0x2F, 0x44, 0xFE, 0x28, 0x88, 0x87, 0x8A, 0x94,
+  0x5D, 0x47, 0xBC, 0xEF, 0x20, 0x55, 0xBE, 0x21, 0x35, 0x4B, 0x90, 0xEA, 0x9F, 0x91, 0x86, 0x9F,
+  0x90, 0xC6, 0xCF, 0x91, 0xFA, 0x1F, 0x90, 0xE6, 0x15, 0x48, 0xFD, 0x97, 0x48, 0xC7, 0x2A, 0xFE,
+  0x28, 0xDA, 0x00, 0xED, 0x5C, 0x07, 0xED, 0x55, 0x13, 0x0D, 0x00, 0xD0, 0x9E, 0xD5, 0xD1, 0xBE,
+  0xDE, 0x28, 0xD6, 0x10, 0xED, 0xD5, 0x15, 0xC5, 0x83, 0xD0, 0xC8, 0xD6, 0x68, 0x64, 0x1F, 0x74,
+  0x54, 0x17, 0x74, 0x50, 0x20, 0x3A, 0xA2, 0x2D, 0x3A, 0x25, 0x10, 0x9D, 0x1A, 0x85, 0xCE, 0x18,
+  0x86, 0xC6, 0x0E, 0x40, 0x67, 0x85, 0xA0, 0x73, 0x43, 0xD1, 0xA5, 0x93, 0xD1, 0xC4, 0xD1, 0xE8,
+  0xF2, 0xC1, 0x68, 0x72, 0x1C, 0xBA, 0x3A, 0x1A, 0x4D, 0x5A, 0x8C, 0x6E, 0x9A, 0x82, 0xA6, 0x2D,
+  0x45, 0xB9, 0x25, 0xE8, 0x66, 0xF7, 0x66, 0xA3, 0xC2, 0x3A, 0x54, 0xD8, 0x88, 0xE6, 0xA5, 0xA3,
+  0x39, 0x2B, 0xD0, 0x9C, 0x24, 0xF4, 0xF4, 0x6A, 0xF4, 0x5C, 0x32, 0x7A, 0x69, 0x15, 0xAA, 0x9C,
+  0x43, 0xD5, 0x53, 0xE8, 0xA3, 0x1C, 0xB4, 0x38, 0x0F, 0x7D, 0x71, 0x10, 0x7D, 0x9E, 0x83, 0xDE,
+  0x3B, 0x8D, 0xDE, 0xBF, 0x80, 0xAA, 0x4F, 0x50, 0xB3, 0x00, 0x2D, 0xD5, 0xD0, 0xCF, 0xCF, 0xD0,
+  0x2F, 0x0F, 0x50, 0xE3, 0x31, 0xFA, 0x3D, 0x1F, 0xF5, 0x28, 0x40, 0xBD, 0x3F, 0xA3, 0x35, 0x2B,
+  0xD1, 0xDA, 0xAF, 0xD1, 0x9A, 0xBF, 0xD0, 0xFA, 0x3F, 0x50, 0xE8, 0x13, 0x0A, 0xFD, 0x46, 0x1B,
+  0x58, 0x68, 0xDD, 0xAA, 0x0D, 0xED, 0xDD, 0x01, 0x7B, 0xAB, 0x1A, 0xF6, 0x80, 0xEA, 0xF6, 0xAE,
+  0xA0, 0x7D, 0xA0, 0x9F, 0xBD, 0x87, 0xBB, 0x8D, 0xEC, 0xFD, 0xDA, 0xD9, 0xC3, 0x02, 0xEC, 0xFD,
+  0x51, 0xFB, 0xC4, 0x1E, 0xF6, 0xA9, 0x1D, 0xED, 0x33, 0x7B, 0xDA, 0x27, 0x04, 0xDA, 0x27, 0x77,
+  0xB1, 0xC7, 0x8C, 0xB0, 0xCF, 0x89, 0xB2, 0xCF, 0x8F, 0xB4, 0xCF, 0x1C, 0x6C, 0x9F, 0xED, 0xB0,
+  0x27, 0x46, 0xD9, 0xFF, 0x1E, 0xFF, 0xBF, 0x5D, 0x3D, 0xDB, 0x9E, 0xBC, 0xCC, 0xBE, 0x63, 0x8E,
+  0x3D, 0x65, 0x86, 0x7D, 0xDD, 0x6C, 0x7B, 0x76, 0xA2, 0x7D, 0x13, 0x65, 0xCF, 0x58, 0x64, 0xE7,
+  0xB7, 0xDB, 0x4F, 0xA6, 0xD9, 0x5D, 0xA9, 0xF6, 0x43, 0x19, 0xF6, 0xB3, 0xEB, 0xED, 0x37, 0xB7,
+  0xDB, 0x2F, 0xEC, 0xB4, 0x9F, 0x72, 0x37, 0xD7, 0x7E, 0xEB, 0x98, 0xBD, 0xE8, 0xA0, 0xFD, 0xEA,
+  0x51, 0x7B, 0xBE, 0xCB, 0x7E, 0x2F, 0xCB, 0xFE, 0x7C, 0x9F, 0xBD, 0xF2, 0x84, 0xFD, 0xB9, 0x6C,
+  0x7F, 0xF5, 0xC4, 0xFE, 0x43, 0xB3, 0x7F, 0xBB, 0x63, 0x2F, 0xBD, 0x69, 0xF7, 0x74, 0xFB, 0x86,
+  0xBD, 0xBA, 0x62, 0xF7, 0x29, 0xB3, 0x57, 0x2B, 0xB3, 0xFF, 0xF5, 0xDD, 0xDE, 0xA0, 0xC2, 0x1E,
+  0xF0, 0xC9, 0xEE, 0xFB, 0xCE, 0xDE, 0xC1, 0xB2, 0xFB, 0xBF, 0xB3, 0x77, 0xF4, 0xF0, 0xC6, 0x10,
+  0x7F, 0x0C, 0x6B, 0x86, 0xF5, 0xF3, 0xC3, 0x86, 0xD4, 0xC0, 0x70, 0x1F, 0x6C, 0x84, 0xDB, 0x35,
+  0xB1, 0xA1, 0x6D, 0xB1, 0x41, 0x5D, 0xB0, 0xB1, 0xCD, 0xB1, 0xE1, 0x01, 0xD8, 0xE8, 0x60, 0x6C,
+  0x42, 0x4F, 0x6C, 0x4A, 0x67, 0x6C, 0x4E, 0x0F, 0x2C, 0x76, 0x04, 0x46, 0x0D, 0xC7, 0x16, 0x8D,
+  0xC0, 0x98, 0x28, 0x2C, 0x79, 0x1C, 0xB6, 0x28, 0x04, 0x5B, 0x3B, 0x10, 0xDB, 0x3C, 0x11, 0x5B,
+  0xE2, 0xC4, 0x98, 0xE9, 0xD8, 0x9A, 0x18, 0x6C, 0xF3, 0x22, 0x2C, 0x73, 0x39, 0x96, 0xB1, 0x14,
+  0xE3, 0x67, 0x62, 0xD9, 0x0B, 0xB0, 0xAC, 0x1D, 0xD8, 0x19, 0x1E, 0x93, 0x56, 0x62, 0x79, 0x29,
+  0x58, 0xDE, 0x56, 0xEC, 0xC4, 0x2A, 0x4C, 0x5E, 0x8B, 0xDD, 0x60, 0xB0, 0xE2, 0x43, 0xD8, 0x4D,
+  0x17, 0xA6, 0xEE, 0xC6, 0xEE, 0xEF, 0xC3, 0x8A, 0x8E, 0x63, 0x45, 0xBB, 0xB1, 0xB2, 0x5C, 0xEC,
+  0xD5, 0x11, 0xEC, 0xBD, 0x82, 0x7D, 0x78, 0x84, 0x79, 0x3C, 0xC6, 0xBE, 0x5F, 0xC2, 0x7E, 0x5E,
+  0xC3, 0x3C, 0x6F, 0x62, 0xD0, 0x45, 0xAC, 0x8E, 0x8A, 0x79, 0x55, 0x60, 0x75, 0x3E, 0x61, 0xF0,
+  0x5B, 0xAC, 0xDE, 0x47, 0xAC, 0xBD, 0x81, 0x75, 0x28, 0xC5, 0x02, 0xBF, 0x63, 0x8D, 0x5E, 0x63,
+  0x3D, 0x3C, 0xBD, 0xF0, 0xF6, 0x0D, 0xF1, 0xB0, 0xDA, 0x78, 0x68, 0x2D, 0x3C, 0x10, 0xC4, 0x23,
+  0x40, 0x7C, 0x64, 0x2D, 0x7C, 0x84, 0xFB, 0xD3, 0x09, 0x27, 0x9A, 0xE3, 0x91, 0xDD, 0x71, 0xB2,
+  0x2B, 0x1E, 0xDF, 0x0F, 0x9F, 0x1A, 0x8C, 0x4F, 0x69, 0x8F, 0xCF, 0xE9, 0x82, 0xC7, 0x8D, 0xC0,
+  0x17, 0xE0, 0x78, 0x62, 0x18, 0xBE, 0x78, 0x22, 0xBE, 0x62, 0x00, 0xBE, 0x26, 0x12, 0xDF, 0x30,
+  0x16, 0x5F, 0x1A, 0x85, 0xAF, 0x4B, 0xC0, 0xB9, 0xE5, 0xF8, 0x9E, 0x29, 0xF8, 0xE6, 0xBF, 0xF1,
+  0xEC, 0x79, 0xF8, 0xD6, 0x38, 0x3C, 0x37, 0x1E, 0xCF, 0x5B, 0x82, 0xEF, 0xFE, 0x07, 0x3F, 0x94,
+  0x84, 0x1F, 0xDE, 0x88, 0x5F, 0x5F, 0x83, 0x9F, 0x49, 0xC7, 0xCF, 0xAD, 0xC4, 0xEF, 0xAC, 0xC3,
+  0x0B, 0x77, 0xE2, 0x17, 0x0F, 0xE2, 0x77, 0x8E, 0xE2, 0xF7, 0x72, 0x70, 0xFD, 0x38, 0x5E, 0x76,
+  0x00, 0xFF, 0x70, 0x14, 0xFF, 0x78, 0x0C, 0x7F, 0xBD, 0x1F, 0xFF, 0xAE, 0xE2, 0x3F, 0x9F, 0xE2,
+  0x1E, 0x17, 0x71, 0x53, 0xC5, 0x7D, 0x6E, 0xE3, 0x50, 0x11, 0xFE, 0xFD, 0x2E, 0xEE, 0x75, 0x05,
+  0x6F, 0xF2, 0x11, 0x6F, 0x50, 0x8E, 0xFB, 0x7D, 0xC4, 0xDB, 0x7C, 0xC3, 0x03, 0x4A, 0xF0, 0x4E,
+  0xEE, 0x7E, 0xC3, 0x9B, 0x96, 0xE1, 0xDD, 0x80, 0xBA, 0x44, 0xB0, 0x07, 0x11, 0x08, 0x10, 0x3D,
+  0x61, 0x62, 0x10, 0x40, 0x0C, 0x02, 0x89, 0xB1, 0x30, 0x11, 0xE2, 0x76, 0x2F, 0xC2, 0xD9, 0x95,
+  0x70, 0xF6, 0x23, 0x62, 0x83, 0x88, 0xD9, 0xDD, 0x88, 0x09, 0xEE, 0xD9, 0x89, 0xE8, 0x40, 0x82,
+  0x22, 0x88, 0xC5, 0xE3, 0x09, 0x76, 0x34, 0x91, 0x3A, 0x88, 0x58, 0x38, 0x96, 0x48, 0x72, 0x10,
+  0xEC, 0x18, 0x22, 0x75, 0x28, 0xB1, 0x75, 0x1E, 0xB1, 0x23, 0x86, 0x58, 0x47, 0x11, 0x07, 0x97,
+  0x13, 0x59, 0xB3, 0x88, 0x63, 0x53, 0x89, 0x63, 0xB1, 0xC4, 0xF9, 0x44, 0xE2, 0xE8, 0x6A, 0x42,
+  0xDC, 0x45, 0x5C, 0x4B, 0x23, 0x6E, 0x6C, 0x25, 0x6E, 0x6F, 0x25, 0xCE, 0x73, 0x84, 0x94, 0x4C,
+  0xDC, 0x75, 0x3B, 0x8F, 0x28, 0xCE, 0x22, 0xEE, 0x08, 0x84, 0x76, 0x9E, 0x78, 0x9D, 0x47, 0x3C,
+  0xCA, 0x24, 0x3E, 0x89, 0x84, 0x79, 0x96, 0x28, 0xD5, 0x08, 0xCF, 0xFF, 0x88, 0x5F, 0x37, 0x89,
+  0x8A, 0x02, 0xE2, 0xFB, 0x13, 0xA2, 0xFA, 0x1D, 0xA2, 0xDE, 0xFF, 0x7D, 0x7C, 0x4B, 0x88, 0x3A,
+  0x9F, 0x89, 0xA6, 0x9F, 0x89, 0x4E, 0xE5, 0x44, 0x83, 0x52, 0x22, 0xD0, 0x22, 0x5A, 0x7F, 0x23,
+  0x5A, 0xBC, 0x20, 0xFA, 0x57, 0xA9, 0xE5, 0xE8, 0xED, 0xE7, 0x08, 0xF7, 0x71, 0xF4, 0x68, 0xE6,
+  0x18, 0xE2, 0xE7, 0xE8, 0xE7, 0xE3, 0x98, 0xEC, 0xEF, 0x08, 0x85, 0x1C, 0x23, 0x3B, 0x3A, 0xC6,
+  0xB5, 0x74, 0x8C, 0xE9, 0xEB, 0x20, 0x83, 0x1C, 0x09, 0xBD, 0x1D, 0xB1, 0x36, 0xC7, 0xFC, 0x36,
+  0x0E, 0xA6, 0xAD, 0x63, 0xC9, 0x30, 0x07, 0x3D, 0xC0, 0xB1, 0xA0, 0xBF, 0x63, 0xD9, 0x38, 0xC7,
+  0xBA, 0x31, 0x0E, 0x26, 0xC2, 0x91, 0x3E, 0xD1, 0x91, 0x3C, 0xD8, 0xC1, 0xCF, 0x71, 0x6C, 0x5F,
+  0xEA, 0xC8, 0x9E, 0xE9, 0xE0, 0xDC, 0x98, 0xE6, 0xC8, 0x21, 0x1D, 0x17, 0x96, 0x3B, 0x0E, 0x2E,
+  0x74, 0x1C, 0x5E, 0xEF, 0x38, 0xB3, 0xC9, 0x71, 0x2D, 0xD9, 0x71, 0x7C, 0xB3, 0xA3, 0x70, 0xBD,
+  0xA3, 0x78, 0x87, 0xE3, 0x76, 0x86, 0xA3, 0x60, 0xA5, 0xE3, 0x6D, 0xA6, 0x43, 0x39, 0xEF, 0x28,
+  0x3B, 0xEC, 0x78, 0xBC, 0xCF, 0xF1, 0x2A, 0xDB, 0x61, 0x66, 0x39, 0x2A, 0x8E, 0x38, 0xBE, 0x89,
+  0x8E, 0x1F, 0x57, 0x1C, 0xE5, 0xC5, 0x0E, 0xDF, 0x47, 0x0E, 0xAF, 0xCB, 0x0E, 0x4F, 0x77, 0x0B,
+  0x1D, 0xD5, 0x9F, 0x38, 0x6A, 0xDC, 0x77, 0xD4, 0xFB, 0xE1, 0x68, 0xF5, 0xC1, 0xE1, 0xFF, 0xCB,
+  0xD1, 0xAE, 0xC4, 0xD1, 0xB4, 0xDC, 0xD1, 0xFB, 0xBB, 0xA3, 0xF3, 0x77, 0x47, 0x9B, 0x37, 0x8E,
+  0xFE, 0x55, 0xFD, 0x9D, 0x83, 0x7D, 0x9C, 0x03, 0x3C, 0x9C, 0x03, 0x7C, 0x9D, 0xC1, 0x80, 0x33,
+  0xCA, 0xCF, 0x39, 0xC4, 0xC3, 0x39, 0xB5, 0x8A, 0x73, 0x66, 0x80, 0x73, 0x74, 0xB0, 0x33, 0x0E,
+  0x75, 0x26, 0x04, 0x3A, 0xE9, 0xEE, 0xCE, 0xE9, 0x3D, 0x9C, 0xB1, 0x41, 0xCE, 0xBF, 0x03, 0x9C,
+  0xFF, 0x0C, 0x71, 0xD2, 0x03, 0x9C, 0xF4, 0x04, 0xE7, 0xBF, 0xC3, 0x9C, 0xCB, 0x31, 0x67, 0x5A,
+  0xA4, 0x93, 0x1F, 0xEF, 0x4C, 0x89, 0x72, 0xA6, 0x2F, 0x73, 0x1E, 0xA5, 0x9D, 0xC7, 0x28, 0xE7,
+  0x31, 0xD2, 0xB9, 0x77, 0xAA, 0xF3, 0xD8, 0x74, 0xE7, 0xC9, 0x44, 0xE7, 0xC9, 0x39, 0xCE, 0xF3,
+  0x6B, 0x9D, 0xA7, 0x76, 0x39, 0x6F, 0xA7, 0x39, 0x0B, 0x53, 0x9D, 0x17, 0x92, 0x9C, 0x77, 0x37,
+  0x3B, 0xAF, 0xAE, 0x77, 0x6A, 0x49, 0xCE, 0xD2, 0x93, 0x4E, 0x3D, 0xD7, 0x59, 0x72, 0xC4, 0xF9,
+  0x64, 0x8F, 0xB3, 0xC4, 0xE5, 0xD4, 0xF3, 0x9C, 0xA5, 0xA7, 0x9D, 0x65, 0xE7, 0x9C, 0xC6, 0x35,
+  0xE7, 0x67, 0xF7, 0xF2, 0x9D, 0x3F, 0x9F, 0x39, 0xFF, 0xBA, 0xE8, 0xAC, 0x53, 0xE8, 0xAC, 0x51,
+  0xE0, 0xF4, 0xBF, 0xE7, 0x84, 0xFF, 0x38, 0x3B, 0x94, 0x3A, 0x5B, 0x96, 0x3A, 0x1B, 0x55, 0x38,
+  0x7B, 0x7D, 0x75, 0xB6, 0x76, 0xCF, 0xFD, 0xF9, 0xE6, 0x0C, 0xF4, 0xA8, 0x43, 0x86, 0xF9, 0x90,
+  0xE1, 0x20, 0x19, 0x5C, 0x9F, 0x74, 0x80, 0xE4, 0x84, 0xEA, 0xA4, 0xC3, 0x0D, 0x4F, 0x72, 0x46,
+  0x1B, 0x72, 0x7C, 0x07, 0x72, 0x0A, 0x42, 0x4E, 0x6C, 0x43, 0xCE, 0x6A, 0x49, 0x2E, 0xE8, 0x45,
+  0x26, 0x06, 0x91, 0x8B, 0xFA, 0x92, 0xF3, 0x42, 0xC9, 0x45, 0xE3, 0xC9, 0xAD, 0x04, 0xB9, 0x65,
+  0x00, 0xB9, 0x7E, 0x34, 0x99, 0x32, 0x99, 0xDC, 0x38, 0x82, 0xDC, 0x32, 0x81, 0x4C, 0x9B, 0x4E,
+  0xEE, 0x48, 0x20, 0xC5, 0x29, 0xE4, 0xBE, 0x39, 0xE4, 0x9E, 0x29, 0xE4, 0xF1, 0xE9, 0xE4, 0xD9,
+  0x29, 0xA4, 0x1C, 0x47, 0x5E, 0x4A, 0x23, 0xAF, 0x32, 0xE4, 0xF9, 0x8D, 0x64, 0xD1, 0x06, 0xF2,
+  0x69, 0x2A, 0xF9, 0x2A, 0x89, 0x7C, 0xBA, 0x8A, 0x2C, 0xDD, 0x41, 0xFE, 0x97, 0x43, 0xBE, 0x39,
+  0x40, 0xBE, 0x3E, 0x4C, 0xBE, 0x92, 0xC8, 0xCA, 0x13, 0x64, 0x49, 0x26, 0xF9, 0xE7, 0x34, 0xF9,
+  0x41, 0x24, 0xAB, 0x5E, 0x25, 0x7F, 0x3C, 0x25, 0xFD, 0x64, 0xD2, 0xA7, 0x98, 0xAC, 0x5B, 0x44,
+  0x7A, 0xDF, 0x22, 0x5B, 0x68, 0x24, 0xF4, 0x98, 0xAC, 0xF7, 0x83, 0xEC, 0xF0, 0x8A, 0x6C, 0x62,
+  0x90, 0xB6, 0x97, 0x64, 0x87, 0x5F, 0x64, 0xD7, 0x52, 0x32, 0xDC, 0xDD, 0xEF, 0x64, 0x77, 0xCF,
+  0x86, 0x14, 0xE1, 0x47, 0x8D, 0xF0, 0xA6, 0xB0, 0x5A, 0x54, 0xB8, 0x2F, 0x15, 0x53, 0x8F, 0x8A,
+  0xAC, 0x4A, 0x91, 0x55, 0xA8, 0x84, 0x4E, 0xD4, 0xF4, 0x60, 0x6A, 0x7E, 0x00, 0x15, 0xDF, 0x85,
+  0x4A, 0x6A, 0x49, 0xD1, 0xCD, 0xA9, 0x15, 0xAD, 0xA9, 0x75, 0x3D, 0xA8, 0xE5, 0x93, 0xA9, 0xAD,
+  0x38, 0x95, 0x32, 0x92, 0xE2, 0xDD, 0x1B, 0x4D, 0xA5, 0x86, 0x52, 0x7C, 0x08, 0x75, 0x80, 0xA0,
+  0xF6, 0xC6, 0x52, 0x19, 0xCB, 0xA9, 0x13, 0x31, 0xD4, 0xE1, 0x65, 0xD4, 0xC9, 0x69, 0xD4, 0x39,
+  0x92, 0x2A, 0x58, 0x4A, 0xB9, 0x96, 0x50, 0xC7, 0xD7, 0x52, 0x17, 0x79, 0x4A, 0x5D, 0x49, 0x15,
+  0xAC, 0xA5, 0x6E, 0x6C, 0xA1, 0xEE, 0xEC, 0xA0, 0x8A, 0x57, 0x51, 0xE5, 0xAB, 0xA9, 0xF7, 0xC7,
+  0xA9, 0xF7, 0xBB, 0xA9, 0xE7, 0x02, 0x65, 0xE4, 0x52, 0x1E, 0x02, 0xF5, 0xE7, 0x38, 0xF5, 0xE1,
+  0x08, 0xE5, 0x79, 0x96, 0xFA, 0x2E, 0x53, 0x56, 0x3E, 0xE5, 0x73, 0x8F, 0x82, 0x8B, 0x29, 0xB8,
+  0x90, 0xAA, 0xF1, 0x80, 0xAA, 0xF9, 0x98, 0xAA, 0x9D, 0x4F, 0xB5, 0x2F, 0xA1, 0x5A, 0x94, 0x53,
+  0x6D, 0x3E, 0x52, 0xBD, 0xFF, 0x50, 0xDD, 0x4A, 0xA8, 0xFE, 0x16, 0x15, 0x54, 0x49, 0xD9, 0x4B,
+  0xA8, 0x21, 0x40, 0x6D, 0x3A, 0xB2, 0x2A, 0x1D, 0x06, 0xD3, 0x23, 0xEB, 0xD1, 0xD1, 0xDE, 0xF4,
+  0x34, 0x2F, 0x7A, 0xAA, 0x17, 0x4D, 0x41, 0x74, 0x4C, 0x30, 0xBD, 0xB0, 0x03, 0x3D, 0xA3, 0x07,
+  0xCD, 0xF4, 0xA4, 0x97, 0x04, 0xD1, 0x09, 0x1D, 0xE8, 0xE4, 0x00, 0x7A, 0x63, 0x7B, 0x7A, 0xFD,
+  0x18, 0x7A, 0xD3, 0x70, 0x7A, 0xF3, 0x48, 0x3A, 0x33, 0x82, 0x4E, 0x0E, 0xA1, 0xF9, 0x09, 0x74,
+  0xFA, 0x10, 0x3A, 0x6B, 0x08, 0x7D, 0x64, 0x29, 0x7D, 0xEA, 0x6F, 0x3A, 0x67, 0x0E, 0x7D, 0x70,
+  0x01, 0x7D, 0x79, 0x06, 0x2D, 0x4F, 0xA5, 0xAF, 0x25, 0xD2, 0x57, 0x96, 0xD1, 0x67, 0xFF, 0xA5,
+  0xF3, 0xD3, 0xE8, 0x07, 0x2B, 0xE8, 0x5B, 0x1C, 0xFD, 0x62, 0x07, 0xFD, 0xDF, 0x2E, 0xBA, 0x78,
+  0x3D, 0xFD, 0x2E, 0x95, 0x2E, 0x3B, 0x47, 0x7F, 0x3F, 0x4F, 0xFF, 0xCC, 0xA3, 0x7F, 0x5F, 0xA0,
+  0xBF, 0x67, 0xD3, 0xD5, 0xCF, 0xD0, 0xBF, 0x8E, 0xD2, 0xDE, 0xFB, 0xE9, 0xDA, 0x32, 0xED, 0xF1,
+  0x84, 0x6E, 0xF8, 0x80, 0x6E, 0xF1, 0x94, 0x6E, 0xF4, 0x90, 0xAE, 0x5F, 0x40, 0x77, 0x74, 0x9F,
+  0x6E, 0x7F, 0xA4, 0x3B, 0xBF, 0xA5, 0x9B, 0xBF, 0xA7, 0xDB, 0xBD, 0xA5, 0xD1, 0x9F, 0x74, 0x50,
+  0x29, 0x3D, 0xEC, 0x2B, 0x8D, 0xBD, 0xA1, 0x89, 0x2A, 0xF5, 0x99, 0xD1, 0xFE, 0x4C, 0xB4, 0x07,
+  0x33, 0xA2, 0x36, 0x33, 0xB3, 0x2A, 0xE3, 0x6C, 0xCA, 0x4C, 0xF2, 0x64, 0xE6, 0xBB, 0x3F, 0x5D,
+  0x98, 0xB9, 0x81, 0x0C, 0xDD, 0x87, 0x59, 0xEA, 0x5E, 0x6F, 0x86, 0x6E, 0xC1, 0xA4, 0xB4, 0x65,
+  0x92, 0x7B, 0x32, 0x49, 0x43, 0x99, 0xD4, 0x28, 0x66, 0x5B, 0x14, 0x93, 0x39, 0x98, 0x49, 0x1B,
+  0xCD, 0x6C, 0xE9, 0xCF, 0x1C, 0x8A, 0x64, 0x44, 0x9C, 0xC9, 0x9B, 0xC9, 0x64, 0x53, 0xCC, 0x99,
+  0xC5, 0xCC, 0x59, 0x9A, 0xB9, 0x3C, 0x97, 0xC9, 0x9D, 0xC3, 0xDC, 0x76, 0x32, 0xF7, 0x67, 0x31,
+  0xF7, 0x18, 0xE6, 0xF2, 0x46, 0xE6, 0xF1, 0x36, 0xE6, 0x51, 0x1A, 0x53, 0x92, 0xCE, 0x3C, 0xDC,
+  0xC5, 0x68, 0x69, 0xCC, 0xF3, 0x55, 0xCC, 0x17, 0x91, 0x29, 0x3F, 0xC1, 0x7C, 0xCD, 0x64, 0x3E,
+  0xED, 0x67, 0xBE, 0xEC, 0x61, 0x80, 0x2C, 0xC6, 0x53, 0x62, 0xAC, 0x5C, 0xC6, 0xE7, 0x3A, 0x53,
+  0xED, 0x31, 0xD3, 0xBC, 0x80, 0xF1, 0xBE, 0xC4, 0x34, 0xBA, 0xCD, 0x74, 0x70, 0x3B, 0x9F, 0x69,
+  0x5F, 0xC4, 0xB4, 0xFE, 0xC8, 0x04, 0x3E, 0x67, 0xDA, 0x7D, 0x60, 0x3A, 0x7E, 0x65, 0x42, 0x4B,
+  0x18, 0xDC, 0x64, 0xBA, 0x95, 0x31, 0x83, 0x2B, 0x98, 0x21, 0x55, 0x6B, 0xB0, 0x43, 0x61, 0x36,
+  0xA6, 0x11, 0x3B, 0xB9, 0x2A, 0x3B, 0xA9, 0x1E, 0x3B, 0x0E, 0x62, 0x27, 0xD4, 0x60, 0xE3, 0x1B,
+  0xB1, 0xB1, 0xED, 0xD9, 0x39, 0x2D, 0xD8, 0xF8, 0x9E, 0xEC, 0x92, 0x7E, 0x2C, 0x13, 0xC8, 0x2E,
+  0x68, 0xC5, 0x26, 0xB7, 0x67, 0xD7, 0x77, 0x66, 0x37, 0x0D, 0x64, 0x93, 0x87, 0xB1, 0x9B, 0xC6,
+  0xB1, 0x3B, 0x07, 0xB2, 0xDB, 0x46, 0xB3, 0xDB, 0x23, 0xD9, 0x9C, 0x70, 0xF6, 0x4C, 0x04, 0x9B,
+  0x4B, 0xB2, 0x47, 0xE3, 0xD9, 0xBC, 0x25, 0xEC, 0xA5, 0x69, 0xEC, 0xA9, 0xA5, 0xEC, 0x45, 0x37,
+  0x12, 0xD8, 0xAB, 0xD1, 0xEC, 0x93, 0x55, 0x6C, 0xFE, 0x1A, 0xF6, 0x66, 0x2A, 0x7B, 0x7F, 0x05,
+  0xFB, 0x64, 0x03, 0xAB, 0x6E, 0x67, 0xDF, 0xB2, 0xAC, 0xB1, 0x99, 0x2D, 0xD9, 0xC7, 0x96, 0x1C,
+  0x65, 0x3F, 0x1D, 0x67, 0x7D, 0x0E, 0xB0, 0x5F, 0xB3, 0xD9, 0x9A, 0x59, 0x2C, 0x98, 0xC3, 0x56,
+  0x3F, 0xCD, 0x7A, 0x5D, 0x64, 0xAB, 0xDF, 0x65, 0x9B, 0xDD, 0x64, 0x7D, 0xAF, 0xB3, 0xFE, 0x37,
+  0xD8, 0x4E, 0xD7, 0xD8, 0xB6, 0x85, 0x6C, 0x40, 0x11, 0x8B, 0x94, 0xB1, 0x1D, 0x7F, 0xB3, 0x03,
+  0x2A, 0xD8, 0xB0, 0x0A, 0x76, 0xA8, 0x1B, 0x3F, 0xD9, 0xD0, 0xF7, 0x2C, 0xF1, 0x8E, 0x1D, 0xE5,
+  0xF1, 0x17, 0x37, 0xAA, 0x3A, 0x37, 0xB4, 0x16, 0x37, 0xA6, 0x0A, 0x17, 0xED, 0xC1, 0xCD, 0xAA,
+  0xCF, 0x4D, 0xF2, 0xE7, 0xA2, 0x6B, 0x71, 0x0B, 0x3A, 0x71, 0x89, 0x28, 0xB7, 0xA2, 0x27, 0x97,
+  0xD4, 0x85, 0xDB, 0xD0, 0x97, 0xFB, 0xA7, 0x2B, 0xB7, 0xD2, 0xDD, 0x9E, 0x5C, 0xF2, 0x58, 0x2E,
+  0x73, 0x12, 0x97, 0x35, 0x8C, 0xDB, 0x1A, 0xCA, 0xED, 0x0C, 0xE1, 0xB2, 0xC7, 0x72, 0x07, 0x06,
+  0x71, 0xB9, 0xE3, 0xB9, 0x83, 0x31, 0xDC, 0xE1, 0xBF, 0xB9, 0x73, 0xD3, 0xB8, 0x73, 0x4B, 0xB9,
+  0xAB, 0xB3, 0xB8, 0x7B, 0x09, 0xDC, 0xC5, 0x38, 0x4E, 0x8D, 0xE7, 0x8A, 0xD2, 0xB9, 0xE7, 0x69,
+  0xDC, 0x73, 0x86, 0x2B, 0x5E, 0xC3, 0x69, 0xAB, 0xB9, 0xF7, 0x0C, 0xF7, 0xE9, 0x5F, 0xEE, 0x0B,
+  0xCF, 0xBD, 0xC9, 0xE4, 0x4A, 0x05, 0xAE, 0x3C, 0x8F, 0xF3, 0x16, 0xB8, 0x3F, 0x02, 0x57, 0xF3,
+  0x0C, 0x07, 0x0A, 0x5C, 0xD3, 0x0B, 0x5C, 0xB5, 0x27, 0x5C, 0xC0, 0x2D, 0xAE, 0xFE, 0x7F, 0x5C,
+  0x87, 0xDB, 0x5C, 0xDD, 0x42, 0xAE, 0x61, 0x21, 0xD7, 0xE2, 0x3E, 0x87, 0xB8, 0x9F, 0x9F, 0xB9,
+  0xBE, 0x3A, 0xD7, 0xA1, 0x94, 0x0B, 0x34, 0xB9, 0x08, 0xB7, 0x2B, 0x39, 0x4C, 0xE7, 0x26, 0x7C,
+  0xE2, 0x86, 0x7B, 0x36, 0xE5, 0xC9, 0x7A, 0x7C, 0x34, 0xC0, 0x4F, 0xA8, 0xCF, 0xCF, 0xF3, 0xE5,
+  0x17, 0x42, 0x7C, 0x0C, 0xC4, 0xC7, 0xD5, 0xE3, 0x13, 0xBA, 0xF3, 0x2B, 0x6D, 0xFC, 0xFC, 0x60,
+  0x3E, 0x39, 0x80, 0x5F, 0xD9, 0x9B, 0x5F, 0xD3, 0x81, 0xDF, 0xD6, 0x95, 0x4F, 0x6D, 0xC7, 0x67,
+  0x0C, 0xE1, 0xB7, 0x0E, 0xE4, 0x37, 0x0C, 0xE7, 0x0F, 0x0F, 0xE1, 0x77, 0x8D, 0xE6, 0xF7, 0x84,
+  0xF0, 0xC7, 0x47, 0xF1, 0x39, 0x83, 0xF9, 0x73, 0xF3, 0xF9, 0x4B, 0xD1, 0xBC, 0x6B, 0x19, 0x5F,
+  0x30, 0x95, 0xBF, 0x46, 0xF3, 0xD7, 0x96, 0xF3, 0x37, 0x17, 0xF3, 0xD7, 0xA3, 0xF9, 0xD7, 0xE9,
+  0xFC, 0xEB, 0x14, 0xFE, 0xD9, 0x26, 0xDE, 0xD8, 0xC1, 0x1B, 0x9B, 0x78, 0x6D, 0x2B, 0xFF, 0x32,
+  0x99, 0xFF, 0x92, 0xC1, 0x97, 0x09, 0xFC, 0x47, 0x89, 0x07, 0x8F, 0xF1, 0xBE, 0x12, 0xEF, 0x73,
+  0x92, 0xAF, 0x72, 0x9C, 0xF7, 0x38, 0xCD, 0x7B, 0xED, 0xE1, 0x5B, 0x15, 0xF3, 0xAD, 0xEE, 0xF1,
+  0xAD, 0x9E, 0xF1, 0xC8, 0x43, 0xBE, 0xD3, 0x75, 0x1E, 0x75, 0xAF, 0x80, 0x0F, 0x2A, 0xE0, 0xFB,
+  0x7C, 0xE3, 0xC3, 0x2A, 0xF9, 0xD0, 0x32, 0x3E, 0xE8, 0x2D, 0x8F, 0x95, 0xF3, 0xE3, 0x7F, 0xF1,
+  0xF8, 0x77, 0x3E, 0xBC, 0x84, 0x9F, 0x0C, 0x34, 0x15, 0xE2, 0x3D, 0x84, 0xF1, 0xEE, 0xFA, 0x0B,
+  0x09, 0x90, 0x30, 0xA5, 0x89, 0x30, 0x1B, 0x12, 0xE6, 0xD6, 0x15, 0xE6, 0x07, 0x08, 0x89, 0x3D,
+  0x84, 0x35, 0x41, 0xC2, 0xE6, 0xAE, 0xC2, 0xF6, 0x0E, 0x02, 0x8F, 0x0A, 0x6B, 0xDB, 0x08, 0xFB,
+  0x7B, 0x08, 0x5B, 0x27, 0x0A, 0x87, 0x1D, 0xC2, 0xB1, 0x10, 0x21, 0x73, 0x90, 0x90, 0x39, 0x5A,
+  0xC8, 0x0A, 0x17, 0x4E, 0x0C, 0x12, 0x4E, 0x63, 0xC2, 0x8D, 0xA5, 0xC2, 0xAD, 0x38, 0x41, 0x4A,
+  0x10, 0x0A, 0xDD, 0x8D, 0x13, 0x9E, 0xCE, 0x10, 0x5E, 0xCC, 0x12, 0x8A, 0x67, 0x09, 0x2F, 0xD7,
+  0x0A, 0x0F, 0x39, 0xE1, 0xCD, 0x2E, 0xC1, 0xD8, 0x29, 0xBC, 0xDF, 0x2E, 0x94, 0xAD, 0x12, 0xBE,
+  0xB8, 0xBD, 0x4E, 0xF8, 0x95, 0x2B, 0x00, 0x87, 0x84, 0xAA, 0x27, 0x84, 0xBA, 0xA2, 0xF0, 0xE7,
+  0xB8, 0xE0, 0x95, 0x29, 0x34, 0xDC, 0x23, 0xD8, 0xF6, 0x0B, 0xAD, 0x0B, 0x85, 0x16, 0x85, 0x42,
+  0xBB, 0x4B, 0x42, 0xCB, 0xEB, 0x42, 0xEB, 0x8B, 0x42, 0xD7, 0x47, 0x42, 0xE0, 0x43, 0xA1, 0xDD,
+  0x13, 0xA1, 0xD3, 0x57, 0x21, 0xD4, 0x12, 0x22, 0xFF, 0x08, 0x11, 0x2F, 0x84, 0x21, 0x86, 0x30,
+  0xE1, 0xBD, 0x30, 0xA9, 0x42, 0x20, 0xCA, 0x85, 0x49, 0x55, 0xFE, 0x12, 0xA3, 0xAB, 0x88, 0x13,
+  0xFD, 0xC5, 0xD9, 0x75, 0xC4, 0x65, 0x35, 0xC5, 0x95, 0xD5, 0xC5, 0xC5, 0x6E, 0xFF, 0x25, 0xAE,
+  0x08, 0x16, 0x37, 0xB4, 0x16, 0x17, 0xB5, 0x14, 0xD7, 0x74, 0x13, 0xB7, 0x75, 0x16, 0xF7, 0xF6,
+  0x12, 0xB7, 0xF4, 0x11, 0xD3, 0xDC, 0x1B, 0x2A, 0xEE, 0x89, 0x12, 0xC5, 0x09, 0x62, 0x0E, 0x21,
+  0x9E, 0xC7, 0xC4, 0xE3, 0x63, 0xC4, 0x83, 0xE1, 0xE2, 0xCD, 0x01, 0xE2, 0xED, 0xC5, 0xE2, 0x9D,
+  0x85, 0xA2, 0x1A, 0x23, 0xE6, 0x4F, 0x17, 0x0B, 0x9C, 0x62, 0x51, 0xBC, 0xF8, 0x8A, 0x16, 0x6F,
+  0x2F, 0x13, 0xEF, 0xAF, 0x11, 0x8B, 0x77, 0x89, 0x9F, 0xB6, 0x88, 0x3F, 0xB7, 0x8B, 0x5F, 0x33,
+  0xC4, 0xCA, 0x34, 0xF1, 0x7D, 0x8A, 0x68, 0xED, 0x10, 0xCD, 0xBD, 0xA2, 0xB9, 0x5B, 0xFC, 0x75,
+  0x44, 0x04, 0x4E, 0x8B, 0x0D, 0x0E, 0x88, 0xCD, 0xF2, 0xC4, 0xBF, 0x04, 0xB1, 0x5D, 0x96, 0xD8,
+  0xF6, 0x86, 0xD8, 0x34, 0x5F, 0x6C, 0x53, 0x24, 0xDA, 0x1F, 0x88, 0xBD, 0xF2, 0xC5, 0x7E, 0x45,
+  0x22, 0x72, 0x4D, 0x1C, 0xF4, 0x9F, 0xD8, 0xF3, 0xB5, 0xD8, 0xAB, 0x4C, 0x0C, 0xFD, 0x28, 0x8E,
+  0x79, 0x23, 0x0E, 0x29, 0x15, 0x27, 0x3F, 0x17, 0x27, 0x95, 0x88, 0x93, 0x2C, 0x31, 0xAA, 0xAA,
+  0x8F, 0x6B, 0x6A, 0x4D, 0xD7, 0xF4, 0xDA, 0xAE, 0x45, 0xB0, 0x6B, 0xA1, 0x97, 0x6B, 0xB9, 0x8F,
+  0x8B, 0xF5, 0x71, 0x31, 0x6E, 0xDB, 0x5D, 0x69, 0xED, 0x5D, 0x6C, 0x77, 0x57, 0x46, 0x6F, 0xD7,
+  0x8E, 0xD6, 0xAE, 0x9D, 0x6D, 0x5C, 0xBB, 0x5A, 0xBA, 0x0E, 0xB5, 0x72, 0x89, 0x13, 0x5D, 0xC7,
+  0x43, 0x5D, 0x3B, 0x47, 0xB9, 0xA4, 0x71, 0xAE, 0xD3, 0x63, 0x5C, 0x47, 0x47, 0xB8, 0x8E, 0x45,
+  0xBA, 0xAE, 0x0E, 0x74, 0x29, 0xF1, 0xAE, 0xEB, 0x31, 0x2E, 0x69, 0x99, 0xAB, 0x28, 0xD6, 0x75,
+  0x7B, 0xA9, 0xEB, 0x41, 0x82, 0xAB, 0x90, 0x74, 0xBD, 0x5A, 0xE2, 0x52, 0x37, 0xBB, 0xDE, 0xAF,
+  0x75, 0x95, 0xF0, 0xAE, 0x2F, 0x2B, 0x5C, 0x15, 0xEE, 0xA6, 0xBA, 0xBC, 0x92, 0x5C, 0xDE, 0x3B,
+  0x5C, 0x3F, 0xCE, 0xB8, 0xFC, 0x2E, 0xB8, 0xEA, 0x9F, 0x75, 0xD5, 0xBE, 0xE0, 0xAA, 0x97, 0xEB,
+  0xF2, 0xC9, 0x72, 0x35, 0x3E, 0xE2, 0x6A, 0xB5, 0xDF, 0xD5, 0xF1, 0x8A, 0xCB, 0xFF, 0xBA, 0xAB,
+  0xC9, 0x35, 0x57, 0x07, 0xF7, 0x9E, 0xB8, 0xBA, 0xDF, 0x75, 0x05, 0x5E, 0x75, 0x0D, 0x2D, 0x72,
+  0xF5, 0x79, 0xEF, 0x0A, 0xFB, 0xEA, 0x8A, 0xFC, 0xED, 0x1A, 0x53, 0xE9, 0x8A, 0xFE, 0xE0, 0x9A,
+  0x56, 0xE2, 0x22, 0x5F, 0xB8, 0x66, 0x3D, 0x77, 0x51, 0x1E, 0xB0, 0x34, 0xDF, 0x4F, 0x5A, 0x50,
+  0x4D, 0x4A, 0xA8, 0x2B, 0x25, 0x35, 0x92, 0x16, 0x78, 0x4A, 0x49, 0xD5, 0xA4, 0xB4, 0x26, 0xD2,
+  0xA2, 0x3E, 0x52, 0xBA, 0x5D, 0xDA, 0xE9, 0x2E, 0x2A, 0xED, 0xEB, 0x28, 0x1D, 0xB0, 0x49, 0x42,
+  0x2F, 0x69, 0x4B, 0x27, 0xE9, 0x60, 0x84, 0x94, 0xDD, 0x5F, 0xCA, 0x1A, 0x22, 0xED, 0x0F, 0x97,
+  0xF2, 0xC6, 0x48, 0x79, 0x83, 0x24, 0x65, 0x88, 0x74, 0x6D, 0x84, 0x74, 0x6D, 0xB1, 0x54, 0x34,
+  0x57, 0x52, 0x97, 0x48, 0x8F, 0x28, 0x49, 0x4F, 0x94, 0xEE, 0xCF, 0x91, 0xDE, 0x2D, 0x95, 0x1E,
+  0xC6, 0x49, 0xA5, 0xA9, 0x52, 0x59, 0x92, 0xF4, 0x26, 0x4D, 0xFA, 0xB5, 0x52, 0xFA, 0xBA, 0x45,
+  0xAA, 0x64, 0xA4, 0xEA, 0x2B, 0x24, 0xDF, 0x8D, 0x92, 0xD7, 0x59, 0xA9, 0xFE, 0x71, 0x09, 0x3A,
+  0x20, 0x79, 0x5D, 0x90, 0xFC, 0x8F, 0x4A, 0xC8, 0x6E, 0xA9, 0x4D, 0x96, 0xD4, 0x65, 0x9F, 0x14,
+  0xF8, 0x40, 0xEA, 0x7A, 0x4B, 0x6A, 0x77, 0x4F, 0x0A, 0x7E, 0x2C, 0xF5, 0xD1, 0xA4, 0x9E, 0xFF,
+  0x49, 0x5D, 0xEE, 0x4B, 0x7D, 0x9E, 0x4A, 0xBD, 0x3F, 0x48, 0x83, 0x5F, 0x49, 0xA1, 0x2F, 0xA5,
+  0x88, 0x32, 0x29, 0xB2, 0x42, 0x1A, 0xFA, 0x56, 0x8A, 0xB6, 0xA4, 0x71, 0x1F, 0xA4, 0x19, 0x9E,
+  0x7E, 0x32, 0x05, 0xCA, 0x73, 0xAB, 0xCB, 0x89, 0xEE, 0x79, 0xCB, 0x6B, 0x21, 0x79, 0xA1, 0xBF,
+  0xBC, 0xA8, 0xAE, 0xBC, 0xAA, 0xAD, 0x9C, 0xDC, 0x49, 0x4E, 0xB5, 0xCB, 0xE9, 0xAD, 0x64, 0x0E,
+  0x91, 0x0F, 0xB4, 0x92, 0x85, 0x16, 0xF2, 0x31, 0x54, 0x3E, 0x30, 0x4E, 0x3E, 0x1D, 0x2E, 0xEF,
+  0x8F, 0x94, 0x0F, 0x13, 0xF2, 0xCD, 0x01, 0xF2, 0x95, 0x89, 0xF2, 0xB9, 0x01, 0xF2, 0xBD, 0x10,
+  0xF9, 0xD1, 0x12, 0xF9, 0xE9, 0x52, 0xF9, 0xC9, 0x14, 0xF9, 0x6E, 0x8C, 0xAC, 0xCE, 0x97, 0xD5,
+  0x78, 0xF9, 0xC3, 0x1C, 0xD9, 0x70, 0x77, 0x87, 0xFC, 0x83, 0x91, 0xDF, 0xAD, 0x90, 0x2B, 0xD6,
+  0xC9, 0xEF, 0x53, 0x64, 0x9F, 0x15, 0x32, 0xB8, 0x56, 0x06, 0x33, 0x64, 0x6B, 0xB7, 0x0C, 0x64,
+  0xCA, 0xDE, 0x79, 0x72, 0xF3, 0xD3, 0x72, 0xCB, 0x53, 0x72, 0xC3, 0xA3, 0x72, 0xC7, 0x23, 0x72,
+  0x87, 0xDD, 0x72, 0xEF, 0x7C, 0xB9, 0xBD, 0x22, 0x77, 0x2E, 0x90, 0x91, 0xBB, 0xF2, 0x90, 0x6B,
+  0xF2, 0xC0, 0x87, 0x72, 0xFF, 0xEB, 0xF2, 0xA8, 0x7C, 0x79, 0xC4, 0x0B, 0x79, 0x80, 0x21, 0x47,
+  0xBC, 0x96, 0x47, 0xBF, 0x97, 0x87, 0xFE, 0x94, 0xC7, 0xE9, 0x72, 0xCC, 0x17, 0x39, 0xB6, 0x5C,
+  0x8E, 0x07, 0x9A, 0x28, 0x2B, 0xFE, 0x52, 0x12, 0xEA, 0x2A, 0xC9, 0xD5, 0x94, 0x45, 0x7E, 0xCA,
+  0x02, 0x50, 0xE1, 0xAA, 0x29, 0xE9, 0x9E, 0xCA, 0x36, 0xBB, 0xB2, 0x33, 0x58, 0xC9, 0xEC, 0xA5,
+  0x64, 0x74, 0x53, 0xB2, 0x7B, 0x28, 0x3B, 0xFA, 0x28, 0xBB, 0xDD, 0xEE, 0xAE, 0x1C, 0x1C, 0xA8,
+  0x64, 0x4F, 0x50, 0x2E, 0x46, 0x28, 0x39, 0x03, 0x94, 0x0B, 0xE3, 0x14, 0x69, 0xA2, 0x72, 0x71,
+  0x84, 0x72, 0x6D, 0xBC, 0x72, 0x6D, 0x81, 0x52, 0x3C, 0x53, 0x79, 0xB0, 0x50, 0x79, 0x1A, 0xA3,
+  0x3C, 0x72, 0x7B, 0xA9, 0xF2, 0x7C, 0xAE, 0xF2, 0x86, 0x56, 0xF4, 0x8D, 0xCA, 0xD7, 0x14, 0xE5,
+  0xEB, 0x3A, 0xA5, 0x62, 0x93, 0x52, 0x73, 0x9B, 0xF2, 0x9B, 0x51, 0x6A, 0xA6, 0x2B, 0xBF, 0x76,
+  0x2A, 0xC0, 0x61, 0x05, 0xBA, 0xA0, 0xB4, 0x38, 0xAF, 0xD8, 0x0E, 0x2B, 0x7E, 0x67, 0x95, 0x26,
+  0xBB, 0x95, 0xCE, 0xFB, 0x15, 0xFB, 0x59, 0xA5, 0xF5, 0x13, 0xA5, 0xBF, 0xAC, 0xB4, 0xBF, 0xA5,
+  0x74, 0xCD, 0x57, 0x7A, 0x14, 0x2B, 0xC1, 0x8F, 0x94, 0xF0, 0x2B, 0xCA, 0xA8, 0x62, 0x65, 0x60,
+  0xB9, 0x32, 0xE2, 0xB7, 0x32, 0xF5, 0xA5, 0x32, 0xF2, 0xA7, 0x32, 0xED, 0x85, 0x12, 0x5B, 0xAE,
+  0x50, 0xCF, 0x95, 0xC4, 0xEF, 0xCA, 0xF4, 0x2A, 0xF5, 0xD5, 0x65, 0x35, 0xD4, 0xC5, 0xCD, 0xD4,
+  0x35, 0x8D, 0x54, 0xB6, 0x81, 0xBA, 0xDC, 0x57, 0xE5, 0xBC, 0xD5, 0xB4, 0x9A, 0xEA, 0x16, 0x54,
+  0x4D, 0x6F, 0xAE, 0xA6, 0x75, 0x51, 0xB3, 0x5B, 0xAA, 0x7B, 0x7B, 0xAA, 0x99, 0x6D, 0xD5, 0x53,
+  0xAD, 0xD4, 0x73, 0x41, 0xEA, 0xE1, 0x61, 0xEA, 0x49, 0x4C, 0xCD, 0x1D, 0xA4, 0xE6, 0x10, 0xEA,
+  0xBD, 0x71, 0xEA, 0xA5, 0x61, 0xEA, 0x7F, 0x0E, 0xF5, 0xCA, 0x48, 0x55, 0x89, 0x55, 0x6F, 0x93,
+  0xEA, 0xE3, 0x18, 0xF5, 0xE9, 0x3C, 0xB5, 0x72, 0xA1, 0xFA, 0x62, 0xBE, 0xFA, 0x74, 0x9A, 0xFA,
+  0x2B, 0x51, 0xFD, 0xB0, 0x53, 0xF5, 0xDC, 0xAE, 0xFA, 0xAC, 0x52, 0x7F, 0xAF, 0x51, 0xFF, 0xAC,
+  0x54, 0x7D, 0xD6, 0xAA, 0xF0, 0x06, 0xD5, 0xDB, 0xFD, 0xD9, 0xAD, 0x82, 0x07, 0xD5, 0x46, 0xE7,
+  0xD5, 0x56, 0x67, 0xD4, 0xB6, 0x07, 0xD4, 0xC0, 0xFD, 0x6A, 0xC7, 0xC3, 0x6A, 0x8F, 0x3C, 0x15,
+  0x55, 0xD4, 0x1E, 0xF7, 0xD4, 0x90, 0xCB, 0x6A, 0xCF, 0xCB, 0x6A, 0xC8, 0x03, 0xB5, 0xAF, 0xAA,
+  0xF6, 0x93, 0xD5, 0xC9, 0xAA, 0x3A, 0xAC, 0x42, 0x75, 0x7C, 0x53, 0xC9, 0x4F, 0xEA, 0x8C, 0x0A,
+  0x75, 0xDE, 0x27, 0x75, 0xEC, 0x6B, 0x35, 0xFE, 0x97, 0x3A, 0xBD, 0x52, 0x9D, 0x5B, 0xB5, 0x89,
+  0xB6, 0xB6, 0xA9, 0x96, 0x52, 0x5F, 0xDB, 0xE8, 0x6E, 0x3D, 0x6D, 0x85, 0xAF, 0xB6, 0xCD, 0x4B,
+  0xDB, 0x5B, 0x43, 0xCB, 0xE8, 0xA2, 0xF1, 0xDD, 0xB5, 0x3D, 0xED, 0xB4, 0x2D, 0x6D, 0xB4, 0xBD,
+  0xED, 0xB5, 0x93, 0x3D, 0x35, 0xB1, 0xAF, 0x76, 0x30, 0x48, 0xCB, 0x1D, 0xAB, 0x5D, 0x8D, 0xD4,
+  0x4E, 0x47, 0x69, 0xB7, 0xC2, 0xB4, 0xCB, 0xA1, 0xDA, 0xDD, 0x91, 0xDA, 0xA5, 0x09, 0x5A, 0xFE,
+  0x58, 0x4D, 0x99, 0xAD, 0x3D, 0x8C, 0xD1, 0xEE, 0x26, 0x6A, 0x95, 0xD3, 0xB5, 0x57, 0xD1, 0xDA,
+  0x7B, 0x4A, 0xD3, 0x67, 0x6A, 0x9F, 0x97, 0x6B, 0xEF, 0x36, 0x69, 0x7F, 0x36, 0x6A, 0x5E, 0xAC,
+  0x66, 0xAE, 0xD5, 0x7E, 0xFD, 0xA3, 0xF9, 0x6D, 0xD0, 0xAA, 0x6D, 0xD4, 0x6A, 0xA5, 0x68, 0xCD,
+  0xCE, 0x6A, 0x01, 0xBB, 0xB5, 0xBA, 0x79, 0x5A, 0xC7, 0x7D, 0x5A, 0xCB, 0x63, 0x5A, 0xE3, 0x1C,
+  0x2D, 0xE0, 0xAC, 0xD6, 0x3A, 0x5B, 0xEB, 0x7B, 0x59, 0xEB, 0x50, 0xAC, 0x45, 0x28, 0x5A, 0xEF,
+  0x4B, 0x5A, 0xF8, 0x53, 0x6D, 0x88, 0xDB, 0x45, 0xDA, 0xF0, 0xFB, 0xDA, 0x28, 0x43, 0x1B, 0xFB,
+  0x55, 0x8B, 0x36, 0xB5, 0xB9, 0x95, 0xDA, 0xDF, 0x2F, 0xB5, 0xB8, 0x57, 0xDA, 0xDF, 0xA5, 0xDA,
+  0x82, 0x9F, 0x5A, 0x9C, 0x87, 0x9F, 0xCE, 0xD4, 0xD0, 0x57, 0x36, 0xD4, 0x53, 0xEA, 0xEB, 0x5B,
+  0x6A, 0xE9, 0xBB, 0x40, 0x3D, 0xB3, 0x89, 0xBE, 0xAE, 0x99, 0xBE, 0xBE, 0xBB, 0x9E, 0xD5, 0x4B,
+  0x3F, 0x66, 0xD7, 0x0F, 0x34, 0xD7, 0x0F, 0x74, 0xD5, 0xF7, 0x74, 0xD0, 0xCF, 0xB9, 0xDD, 0x45,
+  0x3F, 0x15, 0xA2, 0xE7, 0x60, 0xFA, 0xE9, 0x50, 0x5D, 0x1E, 0xAB, 0x17, 0x8E, 0xD7, 0x0B, 0x86,
+  0xEA, 0xCF, 0x46, 0xEB, 0x45, 0x61, 0xFA, 0xDB, 0x59, 0x7A, 0x71, 0xB4, 0xFE, 0x30, 0x4E, 0x7F,
+  0x1A, 0xAD, 0x97, 0xCC, 0xD0, 0xBF, 0x4F, 0xD5, 0x7F, 0x2C, 0xD1, 0xCB, 0x13, 0xF5, 0xAF, 0xE9,
+  0x3A, 0xB8, 0x51, 0xF7, 0xF9, 0x57, 0xFF, 0xBD, 0x42, 0x07, 0xD7, 0xE8, 0xF5, 0xFF, 0xD1, 0x1B,
+  0xF0, 0xFA, 0x5F, 0xEB, 0xF5, 0xA6, 0x67, 0xF4, 0xF6, 0x92, 0xDE, 0xE1, 0x80, 0xDE, 0x28, 0x4B,
+  0x6F, 0x75, 0x50, 0xEF, 0x79, 0x44, 0x0F, 0xCE, 0xD2, 0x07, 0x5E, 0xD0, 0x3B, 0x2A, 0x7A, 0xBF,
+  0x62, 0x3D, 0x2A, 0x5F, 0xEF, 0xFD, 0x4C, 0x8F, 0x2C, 0xD4, 0xFB, 0x6B, 0x7A, 0xC4, 0x23, 0x7D,
+  0xC8, 0x23, 0x7D, 0x84, 0xA5, 0xCF, 0xFE, 0xA2, 0xC7, 0xFE, 0xD1, 0xE3, 0xDC, 0xA8, 0xD0, 0x9D,
+  0x6E, 0xFF, 0xD0, 0x67, 0x7C, 0xD4, 0x17, 0x7B, 0xC2, 0xC6, 0xBF, 0x35, 0x8D, 0x95, 0x8D, 0x8C,
+  0xF5, 0x4D, 0x8C, 0x34, 0x0F, 0x63, 0x6B, 0x03, 0x83, 0x6D, 0x6C, 0x6C, 0xF0, 0x32, 0x0E, 0xB5,
+  0x30, 0xB6, 0x74, 0x32, 0xF6, 0x74, 0x34, 0x76, 0xDB, 0x8D, 0xE3, 0xED, 0x8D, 0x0B, 0xED, 0x8D,
+  0xEB, 0xDD, 0x8C, 0x53, 0x81, 0xC6, 0x85, 0x30, 0xE3, 0xCC, 0x44, 0xE3, 0xEE, 0x18, 0xE3, 0x71,
+  0x94, 0xF1, 0x64, 0x82, 0x51, 0x38, 0xD9, 0xB8, 0x37, 0xDE, 0xB8, 0x3D, 0xC6, 0x28, 0x5E, 0x6E,
+  0x7C, 0xA2, 0x0C, 0x63, 0x86, 0xF1, 0x34, 0xDE, 0x78, 0x35, 0xDF, 0x28, 0x8D, 0x35, 0x7E, 0x38,
+  0x0D, 0xAF, 0x85, 0xC6, 0x97, 0x75, 0x06, 0xB0, 0xDD, 0x68, 0xB0, 0xD3, 0x80, 0xFE, 0x35, 0xAA,
+  0x64, 0x18, 0x7E, 0x69, 0x86, 0x6F, 0x92, 0xD1, 0x9A, 0x35, 0x02, 0xF6, 0x18, 0x0D, 0x0E, 0x18,
+  0xAD, 0xCE, 0x1A, 0x1D, 0xF7, 0x19, 0xED, 0x73, 0x8D, 0x36, 0x79, 0x46, 0xC7, 0x63, 0x46, 0xB7,
+  0x1C, 0xA3, 0xEF, 0x33, 0x63, 0xF8, 0x3D, 0x23, 0xE2, 0xAE, 0x31, 0xE6, 0x92, 0x31, 0xEC, 0xBE,
+  0x11, 0x7A, 0xDB, 0x98, 0xF2, 0xC8, 0x18, 0x76, 0xD9, 0x88, 0xD3, 0x8D, 0xB1, 0xAF, 0x8C, 0x89,
+  0x25, 0xC6, 0xA4, 0x2F, 0x06, 0xFD, 0xCE, 0x58, 0x52, 0x66, 0xAC, 0xFE, 0x6C, 0x2C, 0x36, 0x8D,
+  0x45, 0x80, 0xAF, 0xB9, 0xAA, 0x86, 0x99, 0x02, 0x9A, 0x49, 0xFE, 0x66, 0x7A, 0x1D, 0x33, 0xA5,
+  0xA1, 0xB9, 0xDD, 0xD3, 0x14, 0x01, 0x33, 0x27, 0xC8, 0x3C, 0xDC, 0xD5, 0x3C, 0xD6, 0xDD, 0x3C,
+  0xDF, 0xC9, 0xCC, 0xEA, 0x61, 0x1E, 0xED, 0x6E, 0x1E, 0x41, 0xCD, 0xD3, 0x88, 0x99, 0x1F, 0x61,
+  0x5E, 0x0D, 0x31, 0x2F, 0x86, 0x99, 0xB7, 0x87, 0x9A, 0xD7, 0x06, 0x99, 0xCF, 0x27, 0x99, 0x45,
+  0xE1, 0xA6, 0x31, 0xD8, 0x2C, 0x99, 0x61, 0xBE, 0x58, 0x6A, 0x7E, 0x5E, 0x64, 0x56, 0xB8, 0xEB,
+  0x34, 0x7F, 0xCE, 0x31, 0xAB, 0xCF, 0x32, 0xAB, 0xC6, 0x99, 0xD5, 0xD2, 0x4C, 0x90, 0x35, 0x6B,
+  0xA4, 0x9B, 0x50, 0xB2, 0xE9, 0xBD, 0xD9, 0xF4, 0x5D, 0x67, 0xB6, 0xE2, 0xCD, 0x7A, 0xE9, 0x26,
+  0x9C, 0x63, 0x22, 0xFB, 0xCC, 0xC6, 0x47, 0xCC, 0x56, 0x92, 0xD9, 0xE3, 0x98, 0xD9, 0xF6, 0xAC,
+  0x69, 0xBF, 0x60, 0x06, 0xED, 0x35, 0x87, 0xDF, 0x30, 0xFB, 0xCB, 0x66, 0xBF, 0x62, 0x33, 0xEA,
+  0xB2, 0x19, 0xF5, 0xD0, 0x24, 0x6E, 0x9A, 0x33, 0xEE, 0x9A, 0xE3, 0x1F, 0x98, 0x93, 0x9E, 0x9B,
+  0x8E, 0x17, 0xE6, 0x54, 0xC3, 0x8C, 0xF9, 0x62, 0x2E, 0x7F, 0x69, 0x2E, 0xFC, 0x6C, 0xC6, 0xBF,
+  0x35, 0xD7, 0x95, 0x9A, 0x29, 0x55, 0x6A, 0x59, 0x6C, 0x13, 0x2B, 0xDD, 0xCF, 0xDA, 0xE5, 0x63,
+  0xAD, 0x6F, 0x6C, 0x6D, 0x03, 0x2D, 0xB1, 0xAE, 0x95, 0xD9, 0xD0, 0xCA, 0xE8, 0x6C, 0x1D, 0x0A,
+  0xB0, 0xF6, 0x04, 0x5A, 0x17, 0x7A, 0x59, 0xE7, 0xBB, 0x5B, 0xC7, 0xBA, 0x59, 0x39, 0x9D, 0xAC,
+  0x9B, 0xCD, 0x2D, 0x35, 0xCA, 0xBA, 0x15, 0x61, 0xDD, 0x20, 0x2C, 0x6D, 0xB0, 0xA5, 0x4C, 0xB2,
+  0x8A, 0x47, 0x5A, 0x77, 0x1D, 0x56, 0x11, 0x6E, 0x7D, 0x98, 0x65, 0xE9, 0x73, 0xAC, 0x77, 0x4B,
+  0xAC, 0xEF, 0xCB, 0xAC, 0x9F, 0xF3, 0xAD, 0x8F, 0xB4, 0xF5, 0x67, 0xAE, 0xF5, 0x7B, 0x9E, 0xE5,
+  0x95, 0x64, 0xFD, 0x66, 0xAC, 0xEA, 0x1B, 0xAC, 0x26, 0xDB, 0xAC, 0x26, 0x2B, 0xAD, 0x66, 0xAB,
+  0xAC, 0xE6, 0x9B, 0xAC, 0xA6, 0xFF, 0x58, 0x81, 0x59, 0x56, 0xCB, 0x5C, 0xAB, 0xDB, 0x09, 0x2B,
+  0xE4, 0xA8, 0x85, 0xEC, 0xB1, 0x82, 0x05, 0xAB, 0x7F, 0xB6, 0x15, 0x96, 0x67, 0x85, 0x3E, 0xB0,
+  0x88, 0x5B, 0x16, 0x7E, 0xC3, 0x0A, 0xBB, 0x61, 0x0D, 0xBD, 0x65, 0x91, 0xB2, 0x35, 0xF5, 0x9A,
+  0x35, 0xD7, 0x8D, 0x2F, 0x16, 0xF5, 0xC7, 0x5A, 0xF8, 0xD1, 0x5A, 0xEE, 0xEE, 0x37, 0x2B, 0xF1,
+  0xA5, 0xB5, 0xEA, 0xAB, 0xB5, 0xE2, 0x9D, 0xB5, 0xEE, 0x7F, 0x00, 0x14, 0xFF, 0xF7, 0x1F, 0xCE,
+  0xDB, 0xEE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+};
+
+#endif
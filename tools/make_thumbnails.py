@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Makes the "<png>.thumb" sidecars MapThumbnail shows while a map decodes.
+
+Each is raw RGB565, big-endian as PNGdec's PNG_RGB565_BIG_ENDIAN decodes to,
+1/8 of the image across and down rounded up, each pixel the average of the
+block of up to 8x8 image pixels under it. Put them in the LittleFS data
+directory beside their PNGs.
+
+    python3 tools/make_thumbnails.py data/*.png
+
+Only the standard library is needed: 8-bit greyscale, RGB, palette and the
+alpha variants are decoded here; interlaced and 16-bit PNGs are not.
+"""
+
+import struct
+import sys
+import zlib
+
+DIVISOR = 8         # MapThumbnail::s_divisor
+
+CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG")
+
+    header, palette, idat = None, None, bytearray()
+    pos = 8
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+        pos += 12 + length
+
+    width, height, depth, colour, _, _, interlace = header
+    if depth != 8 or interlace or colour not in CHANNELS or (colour == 3 and palette is None):
+        raise ValueError("unsupported: bit depth %d, colour type %d, interlace %d" % (depth, colour, interlace))
+
+    channels = CHANNELS[colour]
+    stride = width * channels
+    raw = zlib.decompress(bytes(idat))
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(line)
+        prev = line
+
+    def rgb(line, x):
+        i = x * channels
+        if colour == 3:
+            return palette[line[i]]
+        if colour in (0, 4):
+            return (line[i],) * 3
+        return tuple(line[i:i + 3])
+
+    return width, height, [[rgb(line, x) for x in range(width)] for line in rows]
+
+
+def thumbnail(width, height, pixels):
+    out = bytearray()
+    for ty in range((height + DIVISOR - 1) // DIVISOR):
+        for tx in range((width + DIVISOR - 1) // DIVISOR):
+            # the last block across or down may be part of one
+            block = [pixels[y][x]
+                     for y in range(ty * DIVISOR, min((ty + 1) * DIVISOR, height))
+                     for x in range(tx * DIVISOR, min((tx + 1) * DIVISOR, width))]
+            r, g, b = (sum(p[c] for p in block) // len(block) for c in range(3))
+            out += struct.pack(">H", ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return out
+
+
+def main(paths):
+    if not paths:
+        print(__doc__.strip())
+        return 1
+
+    for path in paths:
+        width, height, pixels = read_png(path)
+        thumb = thumbnail(width, height, pixels)
+        with open(path + ".thumb", "wb") as f:
+            f.write(thumb)
+        print("%s.thumb: %dx%d from %dx%d, %d bytes" % (path, (width + DIVISOR - 1) // DIVISOR,
+                                                        (height + DIVISOR - 1) // DIVISOR, width, height, len(thumb)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))